@@ -0,0 +1,485 @@
+/**
+ * @file bench.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Medição do tempo e da memória das operações sobre a lista e o grafo de antenas
+ * @version 0.1
+ * @date 2025-05-30
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Utilização: bench.exe [linhas] [colunas] [densidade] [frequencias] [semente]
+ *
+ * Gera um mapa aleatório com as dimensões indicadas (por omissão 200 x 200, 2% de
+ * antenas, 4 frequências), guarda-o em "bench_mapa.txt" e mede cada operação,
+ * mostrando o tempo por operação, o número de operações por segundo e o pico de
+ * memória do processo depois da operação.
+ * carregarAntenasDeFicheiro só lê linhas até 254 colunas.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "../biblioteca/grafo.h"
+#include "../biblioteca/indice.h"
+#include "../biblioteca/efeitos.h"
+#include "../biblioteca/csr.h"
+#include "../biblioteca/leitura.h"
+#include "../biblioteca/memoria.h"
+#include "../biblioteca/snapshot.h"
+#include "../biblioteca/mapeado.h"
+#include "../biblioteca/implicito.h"
+#include "../biblioteca/quadtree.h"
+#include "../biblioteca/grelha.h"
+#include "../biblioteca/regras.h"
+#include "../biblioteca/colinear.h"
+#include "../biblioteca/faixas.h"
+#include "../biblioteca/formatos.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#include <io.h>
+#define NULO "NUL"
+#define dup _dup
+#define dup2 _dup2
+#define fileno _fileno
+#define close _close
+#else
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#define NULO "/dev/null"
+#endif
+
+#define MAPA_BENCH "bench_mapa.txt"
+#define SNAPSHOT_BENCH "bench_mapa.bin"
+#define MAPEADO_BENCH "bench_mapa.map"
+#define RLE_BENCH "bench_mapa_rle.txt"
+#define REGISTOS_BENCH "bench_mapa_registos.txt"
+
+#pragma region Relógio e Memória
+/**
+ * @brief Devolve o tempo atual de um relógio monótono, em nanossegundos.
+ */
+static double agoraNs(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequencia;
+    LARGE_INTEGER contador;
+    if (frequencia.QuadPart == 0) QueryPerformanceFrequency(&frequencia);
+    QueryPerformanceCounter(&contador);
+    return (double)contador.QuadPart * 1e9 / (double)frequencia.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Devolve o pico de memória residente do processo, em KiB.
+ */
+static long picoMemoriaKiB(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    return (long)(pmc.PeakWorkingSetSize / 1024);
+#else
+    struct rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) != 0) return 0;
+#ifdef __APPLE__
+    return uso.ru_maxrss / 1024;  // Em macOS o valor vem em bytes
+#else
+    return uso.ru_maxrss;
+#endif
+#endif
+}
+#pragma endregion
+#pragma region Saída
+static int saidaGuardada = -1;
+
+/**
+ * @brief Envia o stdout para o dispositivo nulo (para medir funções que imprimem resultados).
+ */
+static void silenciarSaida(void) {
+    fflush(stdout);
+    saidaGuardada = dup(fileno(stdout));
+    FILE* nulo = fopen(NULO, "w");
+    if (nulo) {
+        dup2(fileno(nulo), fileno(stdout));
+        fclose(nulo);
+    }
+}
+
+/**
+ * @brief Repõe o stdout depois de silenciarSaida.
+ */
+static void reporSaida(void) {
+    fflush(stdout);
+    if (saidaGuardada >= 0) {
+        dup2(saidaGuardada, fileno(stdout));
+        close(saidaGuardada);
+        saidaGuardada = -1;
+    }
+}
+
+/**
+ * @brief Mostra uma linha de resultados.
+ *
+ * @param nome Nome da operação.
+ * @param operacoes Número de operações feitas.
+ * @param ns Tempo total em nanossegundos.
+ */
+static void mostrarResultado(const char* nome, long operacoes, double ns) {
+    double porOperacao = operacoes > 0 ? ns / (double)operacoes : 0.0;
+    double porSegundo = ns > 0 ? (double)operacoes * 1e9 / ns : 0.0;
+    printf("%-34s %10ld %14.1f %14.0f %10ld\n", nome, operacoes, porOperacao, porSegundo, picoMemoriaKiB());
+}
+#pragma endregion
+#pragma region Gerar Mapa
+/**
+ * @brief Gerador pseudoaleatório xorshift64* (o mesmo mapa para a mesma semente).
+ */
+static uint64_t aleatorio(uint64_t* estado) {
+    uint64_t x = *estado;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *estado = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief Gera um mapa de antenas aleatório e guarda-o no formato de "antenas.txt".
+ *
+ * @param nomeFicheiro Ficheiro a escrever.
+ * @param linhas Número de linhas do mapa.
+ * @param colunas Número de colunas do mapa.
+ * @param densidade Probabilidade de cada posição ter uma antena (0 a 1).
+ * @param frequencias Número de frequências diferentes (1 a 62: '0'-'9', 'A'-'Z', 'a'-'z').
+ * @param semente Semente do gerador.
+ * @return Número de antenas geradas, ou -1 em caso de erro.
+ */
+static long gerarMapa(const char* nomeFicheiro, int linhas, int colunas, double densidade,
+                      int frequencias, uint64_t semente) {
+    static const char simbolos[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    FILE* file = fopen(nomeFicheiro, "w");
+    if (!file) {
+        printf("Erro ao criar o ficheiro %s!\n", nomeFicheiro);
+        return -1;
+    }
+    char* linha = (char*)malloc((size_t)colunas + 2);
+    if (!linha) {
+        fclose(file);
+        return -1;
+    }
+    uint64_t estado = semente ? semente : 1;
+    long total = 0;
+    for (int i = 0; i < linhas; i++) {
+        for (int j = 0; j < colunas; j++) {
+            // Os 53 bits de maior peso dão um valor em [0, 1), por isso densidade 1 enche o mapa
+            if ((double)(aleatorio(&estado) >> 11) * (1.0 / 9007199254740992.0) < densidade) {
+                linha[j] = simbolos[aleatorio(&estado) % (uint64_t)frequencias];
+                total++;
+            } else {
+                linha[j] = '.';
+            }
+        }
+        linha[colunas] = '\n';
+        fwrite(linha, 1, (size_t)colunas + 1, file);
+    }
+    free(linha);
+    fclose(file);
+    return total;
+}
+
+/**
+ * @brief Cópia dos dados de uma antena do mapa gerado.
+ */
+typedef struct antenaBench {
+    char frequencia;
+    int x, y;
+} AntenaBench;
+
+/**
+ * @brief Baralha um vetor de antenas (Fisher-Yates), para inserir e remover por ordem aleatória.
+ */
+static void baralhar(AntenaBench* v, long n, uint64_t* estado) {
+    for (long i = n - 1; i > 0; i--) {
+        long j = (long)(aleatorio(estado) % (uint64_t)(i + 1));
+        AntenaBench t = v[i];
+        v[i] = v[j];
+        v[j] = t;
+    }
+}
+
+/**
+ * @brief Conta os vértices marcados como visitados pela dfs recursiva.
+ */
+static int contarVisitados(Vertice* lista) {
+    int total = 0;
+    for (; lista; lista = lista->prox) total += lista->visitado != 0;
+    return total;
+}
+
+/**
+ * @brief Conta as adjacências de todos os vértices.
+ */
+static long contarArestas(Vertice* lista) {
+    long total = 0;
+    for (; lista; lista = lista->prox) {
+        for (AdjD* adj = lista->adjacencias; adj; adj = adj->next) total++;
+    }
+    return total;
+}
+#pragma endregion
+#pragma region Main
+int main(int argc, char* argv[]) {
+    int linhas = argc > 1 ? atoi(argv[1]) : 200;
+    int colunas = argc > 2 ? atoi(argv[2]) : 200;
+    double densidade = argc > 3 ? atof(argv[3]) : 0.02;
+    int frequencias = argc > 4 ? atoi(argv[4]) : 4;
+    uint64_t semente = argc > 5 ? (uint64_t)strtoull(argv[5], NULL, 10) : 12345;
+    if (linhas <= 0 || colunas <= 0 || densidade < 0 || densidade > 1 || frequencias < 1 || frequencias > 62) {
+        printf("Utilização: %s [linhas] [colunas] [densidade 0-1] [frequencias 1-62] [semente]\n", argv[0]);
+        return 1;
+    }
+    long n = gerarMapa(MAPA_BENCH, linhas, colunas, densidade, frequencias, semente);
+    if (n < 0) return 1;
+    printf("Mapa %d x %d, densidade %.3f, %d frequências: %ld antenas\n\n", linhas, colunas, densidade, frequencias, n);
+    printf("%-34s %10s %14s %14s %10s\n", "Operação", "ops", "ns/op", "ops/s", "pico KiB");
+
+    double t;
+    int res;
+    uint64_t estado = semente ^ 0x9E3779B97F4A7C15ULL;
+
+    // Leitura do ficheiro de texto
+    Vertice* lista = NULL;
+    if (colunas <= 254) {
+        t = agoraNs();
+        lista = carregarAntenasDeFicheiro(MAPA_BENCH);
+        mostrarResultado("carregarAntenasDeFicheiro", n, agoraNs() - t);
+        libertarMemoria(lista);
+    }
+    t = agoraNs();
+    lista = carregarAntenasMapeado(MAPA_BENCH);
+    mostrarResultado("carregarAntenasMapeado", n, agoraNs() - t);
+
+    // Formatos esparsos (registos "f x y" e linhas comprimidas)
+    FILE* registos = fopen(REGISTOS_BENCH, "w");
+    if (registos) {
+        for (Vertice* v = lista; v; v = v->prox) fprintf(registos, "%c %d %d\n", v->frequencia, v->x, v->y);
+        fclose(registos);
+        t = agoraNs();
+        Vertice* esparsa = carregarAntenasAuto(REGISTOS_BENCH, NULL);
+        mostrarResultado("carregarAntenasAuto registos", n, agoraNs() - t);
+        libertarMemoria(esparsa);
+    }
+    if (guardarAntenasRLE(lista, RLE_BENCH) == 0) {
+        t = agoraNs();
+        Vertice* esparsa = carregarAntenasAuto(RLE_BENCH, NULL);
+        mostrarResultado("carregarAntenasAuto RLE", n, agoraNs() - t);
+        libertarMemoria(esparsa);
+    }
+
+    // Inserção e remoção por ordem aleatória
+    AntenaBench* antenas = (AntenaBench*)malloc((size_t)(n > 0 ? n : 1) * sizeof(AntenaBench));
+    Vertice** novas = (Vertice**)malloc((size_t)(n > 0 ? n : 1) * sizeof(Vertice*));
+    if (!antenas || !novas) {
+        free(antenas);
+        free(novas);
+        libertarMemoria(lista);
+        return 1;
+    }
+    long k = 0;
+    for (Vertice* v = lista; v; v = v->prox, k++) {
+        antenas[k].frequencia = v->frequencia;
+        antenas[k].x = v->x;
+        antenas[k].y = v->y;
+    }
+    baralhar(antenas, n, &estado);
+    for (long i = 0; i < n; i++) novas[i] = criarAntena(antenas[i].frequencia, antenas[i].x, antenas[i].y);
+    Vertice* inseridas = NULL;
+    t = agoraNs();
+    for (long i = 0; i < n; i++) inseridas = InsereAntena(novas[i], inseridas, &res);
+    mostrarResultado("InsereAntena", n, agoraNs() - t);
+    baralhar(antenas, n, &estado);
+    t = agoraNs();
+    for (long i = 0; i < n; i++) inseridas = removeAntena(inseridas, antenas[i].x, antenas[i].y);
+    mostrarResultado("removeAntena", n, agoraNs() - t);
+
+    IndiceAntenas* indice = criarIndice((int)n);
+    for (long i = 0; i < n; i++) novas[i] = criarAntena(antenas[i].frequencia, antenas[i].x, antenas[i].y);
+    t = agoraNs();
+    for (long i = 0; i < n; i++) inseridas = InsereAntenaIndexada(novas[i], inseridas, indice, &res);
+    mostrarResultado("InsereAntenaIndexada", n, agoraNs() - t);
+    baralhar(antenas, n, &estado);
+    t = agoraNs();
+    for (long i = 0; i < n; i++) inseridas = removeAntenaIndexada(inseridas, indice, antenas[i].x, antenas[i].y);
+    mostrarResultado("removeAntenaIndexada", n, agoraNs() - t);
+    libertarIndice(indice);
+    libertarMemoria(inseridas);
+    free(novas);
+    free(antenas);
+
+    // Construção do grafo
+    t = agoraNs();
+    CriarGrafo(lista);
+    double tempo = agoraNs() - t;
+    long arestas = contarArestas(lista);
+    mostrarResultado("CriarGrafo (por aresta)", arestas, tempo);
+    libertarMemoria(lista);
+
+    lista = carregarAntenasMapeado(MAPA_BENCH);
+    t = agoraNs();
+    CriarGrafoPorFrequencia(lista);
+    mostrarResultado("CriarGrafoPorFrequencia (aresta)", arestas, agoraNs() - t);
+
+    // Efeitos nefastos (a versão que imprime é medida com o stdout silenciado)
+    silenciarSaida();
+    t = agoraNs();
+    calcularEfeitosNefastos(lista);
+    tempo = agoraNs() - t;
+    reporSaida();
+    mostrarResultado("calcularEfeitosNefastos (antena)", n, tempo);
+    t = agoraNs();
+    ConjuntoEfeitos* efeitos = calcularEfeitos(lista, EFEITO_DISTANCIA_2);
+    mostrarResultado("calcularEfeitos (antena)", n, agoraNs() - t);
+    libertarConjuntoEfeitos(efeitos);
+    t = agoraNs();
+    GrelhaAntenas* grelha = criarGrelha(lista);
+    mostrarResultado("criarGrelha (antena)", n, agoraNs() - t);
+    if (grelha) {
+        t = agoraNs();
+        efeitos = calcularEfeitosGrelha(grelha);
+        mostrarResultado("calcularEfeitosGrelha (antena)", n, agoraNs() - t);
+        libertarConjuntoEfeitos(efeitos);
+        libertarGrelha(grelha);
+    }
+
+    // Várias regras: uma passagem por regra e uma só passagem para todas
+    TipoRegra regras[] = { REGRA_DISTANCIA_2, REGRA_DISTANCIA_PAR, REGRA_COLINEAR, REGRA_ANTINODOS };
+    ConjuntoEfeitos* porRegra[4];
+    t = agoraNs();
+    for (int r = 0; r < 4; r++) {
+        porRegra[r] = aplicarRegra(lista, regras[r], NULL);
+    }
+    mostrarResultado("aplicarRegra x4 (antena)", n, agoraNs() - t);
+    for (int r = 0; r < 4; r++) libertarConjuntoEfeitos(porRegra[r]);
+    t = agoraNs();
+    if (aplicarRegras(lista, regras, 4, NULL, porRegra) == 0) {
+        mostrarResultado("aplicarRegras 4 regras (antena)", n, agoraNs() - t);
+        for (int r = 0; r < 4; r++) libertarConjuntoEfeitos(porRegra[r]);
+    }
+    t = agoraNs();
+    ResultadoColinear* colineares = calcularColineares(lista, 3, 0);
+    mostrarResultado("calcularColineares (antena)", n, agoraNs() - t);
+    libertarColineares(colineares);
+    t = agoraNs();
+    processarPorFaixas(MAPA_BENCH, 64, NULL, NULL);
+    mostrarResultado("processarPorFaixas 64 linhas (antena)", n, agoraNs() - t);
+
+    // Pesquisas a partir da primeira antena
+    if (lista) {
+        silenciarSaida();
+        t = agoraNs();
+        dfs(lista);
+        tempo = agoraNs() - t;
+        reporSaida();
+        int visitados = contarVisitados(lista);
+        limparVisitados(lista);
+        mostrarResultado("dfs (vértice)", visitados, tempo);
+        silenciarSaida();
+        t = agoraNs();
+        visitados = dfsIterativo(lista);
+        tempo = agoraNs() - t;
+        reporSaida();
+        mostrarResultado("dfsIterativo (vértice)", visitados, tempo);
+
+        t = agoraNs();
+        GrafoCSR* g = construirCSR(lista);
+        mostrarResultado("construirCSR (aresta)", arestas, agoraNs() - t);
+        if (g) {
+            int* ordemCSR = (int*)malloc((size_t)g->numVertices * sizeof(int));
+            if (ordemCSR) {
+                t = agoraNs();
+                visitados = dfsCSR(g, 0, ordemCSR);
+                mostrarResultado("dfsCSR (vértice)", visitados, agoraNs() - t);
+                free(ordemCSR);
+            }
+            libertarCSR(g);
+        }
+    }
+
+    // Snapshot binário
+    t = agoraNs();
+    guardarGrafoBinario(lista, SNAPSHOT_BENCH);
+    mostrarResultado("guardarGrafoBinario (antena)", n, agoraNs() - t);
+    libertarMemoria(lista);
+    t = agoraNs();
+    lista = carregarAntenasDeFicheiroBinario(SNAPSHOT_BENCH, NULL);
+    mostrarResultado("carregarAntenasDeFicheiroBinario", n, agoraNs() - t);
+    libertarMemoria(lista);
+    ArenaGrafo* arena = criarArena();
+    t = agoraNs();
+    lista = carregarAntenasDeFicheiroBinario(SNAPSHOT_BENCH, arena);
+    mostrarResultado("... com arena", n, agoraNs() - t);
+
+    // Grafo mapeado (consultado no ficheiro, sem ser reconstruído)
+    t = agoraNs();
+    guardarGrafoMapeado(lista, MAPEADO_BENCH);
+    mostrarResultado("guardarGrafoMapeado (antena)", n, agoraNs() - t);
+    t = agoraNs();
+    GrafoMapeado* mapeado = abrirGrafoMapeado(MAPEADO_BENCH, 0);
+    mostrarResultado("abrirGrafoMapeado", n, agoraNs() - t);
+    fecharGrafoMapeado(mapeado);
+    t = agoraNs();
+    mapeado = abrirGrafoMapeado(MAPEADO_BENCH, 1);
+    mostrarResultado("... com verificação", n, agoraNs() - t);
+    if (mapeado) {
+        int encontrados = 0;
+        t = agoraNs();
+        for (Vertice* v = lista; v; v = v->prox) {
+            encontrados += procurarVerticeMapeado(mapeado, v->x, v->y) >= 0;
+        }
+        mostrarResultado("procurarVerticeMapeado (antena)", encontrados, agoraNs() - t);
+    }
+    fecharGrafoMapeado(mapeado);
+    libertarArena(arena);
+
+    // Grafo implícito (ligações por frequência sem adjacências)
+    lista = carregarAntenasMapeado(MAPA_BENCH);
+    t = agoraNs();
+    GrafoImplicito* implicito = criarGrafoImplicito(lista);
+    mostrarResultado("criarGrafoImplicito (antena)", n, agoraNs() - t);
+    if (implicito && lista) {
+        t = agoraNs();
+        int visitados = bfsImplicito(implicito, lista);
+        mostrarResultado("bfsImplicito (vértice)", visitados, agoraNs() - t);
+    }
+    libertarGrafoImplicito(implicito);
+
+    // Índice espacial
+    t = agoraNs();
+    QuadtreeAntenas* quadtree = construirQuadtree(lista);
+    mostrarResultado("construirQuadtree (antena)", n, agoraNs() - t);
+    if (quadtree) {
+        long consultas = 10000;
+        t = agoraNs();
+        for (long i = 0; i < consultas; i++) {
+            int x = 1 + (int)(aleatorio(&estado) % (uint64_t)linhas);
+            int y = 1 + (int)(aleatorio(&estado) % (uint64_t)colunas);
+            libertarResultadoEspacial(procurarMaisProximas(quadtree, x, y, 8, 0));
+        }
+        mostrarResultado("procurarMaisProximas k=8", consultas, agoraNs() - t);
+        libertarQuadtree(quadtree);
+    }
+    libertarMemoria(lista);
+
+    remove(MAPA_BENCH);
+    remove(SNAPSHOT_BENCH);
+    remove(MAPEADO_BENCH);
+    remove(RLE_BENCH);
+    remove(REGISTOS_BENCH);
+    return 0;
+}
+#pragma endregion
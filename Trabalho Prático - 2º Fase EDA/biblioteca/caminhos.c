@@ -0,0 +1,859 @@
+/**
+ * @file caminhos.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da consulta de caminhos com contagem rápida e paragem antecipada
+ * @version 0.1
+ * @date 2025-06-01
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+#include "caminhos.h"
+
+/**
+ * @brief Parte do grafo que interessa a uma consulta, em formato compacto.
+ *
+ * Contém os vértices alcançáveis a partir da origem (sem continuar depois do destino,
+ * porque os caminhos terminam lá), numerados de 0 a m - 1 pela ordem da pesquisa.
+ * Os vizinhos de cada vértice mantêm a ordem da lista de adjacências.
+ */
+typedef struct subgrafoCaminhos {
+    int m;                       // Número de vértices
+    Vertice** vertices;          // Vértice correspondente a cada número
+    int* inicio;                 // Primeiro vizinho de cada vértice (m + 1)
+    int* vizinhos;
+    char* util;                  // 1 se o vértice consegue chegar ao destino
+    int origem, destino;
+} SubgrafoCaminhos;
+
+#pragma region Contas com Saturação
+/**
+ * @brief Soma dois contadores; se o resultado não couber fica ULLONG_MAX.
+ */
+static unsigned long long somarContagem(unsigned long long a, unsigned long long b, int* saturado) {
+    if (a > ULLONG_MAX - b) {
+        *saturado = 1;
+        return ULLONG_MAX;
+    }
+    return a + b;
+}
+
+/**
+ * @brief Multiplica dois contadores; se o resultado não couber fica ULLONG_MAX.
+ */
+static unsigned long long multiplicarContagem(unsigned long long a, unsigned long long b, int* saturado) {
+    if (a != 0 && b > ULLONG_MAX / a) {
+        *saturado = 1;
+        return ULLONG_MAX;
+    }
+    return a * b;
+}
+#pragma endregion
+#pragma region Subgrafo da Consulta
+/**
+ * @brief Liberta a memória de um subgrafo.
+ */
+static void libertarSubgrafo(SubgrafoCaminhos* sg) {
+    free(sg->vertices);
+    free(sg->inicio);
+    free(sg->vizinhos);
+    free(sg->util);
+}
+
+/**
+ * @brief Constrói o subgrafo alcançável a partir da origem e marca os vértices úteis.
+ *
+ * Os vértices são encontrados com uma BFS que usa as épocas (novaEpocaPesquisa) e o campo "id"
+ * guarda temporariamente o número local de cada vértice (o valor anterior é reposto).
+ * Depois uma BFS pelas arestas invertidas a partir do destino marca os vértices que
+ * conseguem chegar ao destino: só esses podem fazer parte de um caminho.
+ *
+ * @param origem Vértice de partida.
+ * @param destino Vértice de destino.
+ * @param sg Subgrafo a preencher.
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int construirSubgrafo(Vertice* origem, Vertice* destino, SubgrafoCaminhos* sg) {
+    sg->m = 0;
+    sg->vertices = NULL;
+    sg->inicio = NULL;
+    sg->vizinhos = NULL;
+    sg->util = NULL;
+    unsigned int epoca = novaEpocaPesquisa();
+    int capacidade = 64, m = 0;
+    Vertice** vertices = (Vertice**)malloc(capacidade * sizeof(Vertice*));
+    int* idAnterior = (int*)malloc(capacidade * sizeof(int));
+    if (!vertices || !idAnterior) {
+        free(vertices); free(idAnterior);
+        return 0;
+    }
+    origem->epoca = epoca;
+    idAnterior[m] = origem->id;
+    origem->id = m;
+    vertices[m++] = origem;
+    int numArestas = 0, erro = 0;
+    for (int i = 0; i < m && !erro; i++) {
+        if (vertices[i] == destino) continue;  // Os caminhos terminam no destino
+        for (AdjD* adj = vertices[i]->adjacencias; adj && !erro; adj = adj->next) {
+            Vertice* w = adj->destino;
+            if (!w) continue;
+            numArestas++;
+            if (w->epoca == epoca) continue;
+            if (m == capacidade) {
+                capacidade *= 2;
+                Vertice** nv = (Vertice**)realloc(vertices, capacidade * sizeof(Vertice*));
+                if (nv) vertices = nv;
+                int* ni = (int*)realloc(idAnterior, capacidade * sizeof(int));
+                if (ni) idAnterior = ni;
+                if (!nv || !ni) {
+                    erro = 1;
+                    break;
+                }
+            }
+            w->epoca = epoca;
+            idAnterior[m] = w->id;
+            w->id = m;
+            vertices[m++] = w;
+        }
+    }
+    int* inicio = erro ? NULL : (int*)malloc((size_t)(m + 1) * sizeof(int));
+    int* vizinhos = erro ? NULL : (int*)malloc((size_t)(numArestas > 0 ? numArestas : 1) * sizeof(int));
+    char* util = erro ? NULL : (char*)calloc((size_t)m, 1);
+    if (inicio && vizinhos && util) {
+        int e = 0;
+        for (int i = 0; i < m; i++) {
+            inicio[i] = e;
+            if (vertices[i] == destino) continue;
+            for (AdjD* adj = vertices[i]->adjacencias; adj; adj = adj->next) {
+                if (adj->destino) vizinhos[e++] = adj->destino->id;
+            }
+        }
+        inicio[m] = e;
+    }
+    // Repor os números que os vértices tinham antes da consulta
+    for (int i = 0; i < m; i++) {
+        vertices[i]->id = idAnterior[i];
+    }
+    free(idAnterior);
+    sg->m = m;
+    sg->vertices = vertices;
+    sg->inicio = inicio;
+    sg->vizinhos = vizinhos;
+    sg->util = util;
+    sg->origem = 0;
+    sg->destino = -1;
+    for (int i = 0; i < m; i++) {
+        if (vertices[i] == destino) sg->destino = i;
+    }
+    if (!inicio || !vizinhos || !util) {
+        libertarSubgrafo(sg);
+        return 0;
+    }
+    if (sg->destino < 0) return 1;  // Destino inalcançável: nenhum vértice é útil
+
+    // Arestas invertidas (CSR) para a BFS a partir do destino
+    int* inicioInv = (int*)calloc((size_t)m + 1, sizeof(int));
+    int* inversos = (int*)malloc((size_t)(inicio[m] > 0 ? inicio[m] : 1) * sizeof(int));
+    int* fila = (int*)malloc((size_t)m * sizeof(int));
+    if (!inicioInv || !inversos || !fila) {
+        free(inicioInv); free(inversos); free(fila);
+        libertarSubgrafo(sg);
+        return 0;
+    }
+    for (int e = 0; e < inicio[m]; e++) inicioInv[vizinhos[e] + 1]++;
+    for (int i = 0; i < m; i++) inicioInv[i + 1] += inicioInv[i];
+    for (int v = 0; v < m; v++) {
+        for (int e = inicio[v]; e < inicio[v + 1]; e++) inversos[inicioInv[vizinhos[e]]++] = v;
+    }
+    for (int i = m; i > 0; i--) inicioInv[i] = inicioInv[i - 1];
+    inicioInv[0] = 0;
+    int cabeca = 0, cauda = 0;
+    util[sg->destino] = 1;
+    fila[cauda++] = sg->destino;
+    while (cabeca < cauda) {
+        int w = fila[cabeca++];
+        for (int e = inicioInv[w]; e < inicioInv[w + 1]; e++) {
+            int v = inversos[e];
+            if (!util[v]) {
+                util[v] = 1;
+                fila[cauda++] = v;
+            }
+        }
+    }
+    free(inicioInv);
+    free(inversos);
+    free(fila);
+    return 1;
+}
+#pragma endregion
+#pragma region Contagem Rápida
+/**
+ * @brief Conta os caminhos se o subgrafo for completo (todas as antenas ligadas a todas).
+ *
+ * É o caso de uma frequência depois de CriarGrafo. Com m vértices, um caminho com k arestas
+ * escolhe por ordem k - 1 dos m - 2 vértices intermédios, por isso há (m-2)!/(m-1-k)! caminhos
+ * com k arestas, para k de 1 a m - 1.
+ *
+ * @param sg Subgrafo da consulta.
+ * @param maxComprimento Número máximo de arestas (0 = sem limite).
+ * @param total Onde fica o número de caminhos.
+ * @param saturado Marcado se o número não couber.
+ * @return 1 se o subgrafo é completo (total preenchido), 0 caso contrário.
+ */
+static int contarCaminhosClique(SubgrafoCaminhos* sg, int maxComprimento, unsigned long long* total, int* saturado) {
+    int m = sg->m;
+    int* marca = (int*)calloc((size_t)m, sizeof(int));
+    if (!marca) return 0;
+    int completo = 1;
+    for (int v = 0; v < m && completo; v++) {
+        if (v == sg->destino) continue;
+        if (sg->inicio[v + 1] - sg->inicio[v] != m - 1) completo = 0;
+        for (int e = sg->inicio[v]; e < sg->inicio[v + 1] && completo; e++) {
+            int w = sg->vizinhos[e];
+            if (w == v || marca[w] == v + 1) completo = 0;  // Lacete ou aresta repetida
+            marca[w] = v + 1;
+        }
+    }
+    free(marca);
+    if (!completo) return 0;
+    int maxK = m - 1;
+    if (maxComprimento > 0 && maxComprimento < maxK) maxK = maxComprimento;
+    unsigned long long termo = 1, soma = 0;
+    for (int k = 1; k <= maxK; k++) {
+        soma = somarContagem(soma, termo, saturado);
+        termo = multiplicarContagem(termo, (unsigned long long)(m - 1 - k), saturado);
+    }
+    *total = soma;
+    return 1;
+}
+
+/**
+ * @brief Conta os caminhos se os vértices úteis do subgrafo não tiverem ciclos.
+ *
+ * Num grafo sem ciclos todos os percursos são caminhos simples, por isso o número de
+ * caminhos de v até ao destino é a soma dos números dos seus sucessores (ordem
+ * topológica inversa). Com limite de comprimento a soma é feita por camadas:
+ * percursos com l arestas a partir dos percursos com l - 1 arestas.
+ *
+ * @param sg Subgrafo da consulta.
+ * @param maxComprimento Número máximo de arestas (0 = sem limite).
+ * @param total Onde fica o número de caminhos.
+ * @param saturado Marcado se o número não couber.
+ * @return 1 se não há ciclos (total preenchido), 0 caso contrário ou em caso de erro de memória.
+ */
+static int contarCaminhosDAG(SubgrafoCaminhos* sg, int maxComprimento, unsigned long long* total, int* saturado) {
+    int m = sg->m;
+    int* grau = (int*)calloc((size_t)m, sizeof(int));
+    int* ordem = (int*)malloc((size_t)m * sizeof(int));
+    unsigned long long* atual = (unsigned long long*)calloc((size_t)m, sizeof(unsigned long long));
+    unsigned long long* seguinte = (unsigned long long*)calloc((size_t)m, sizeof(unsigned long long));
+    if (!grau || !ordem || !atual || !seguinte) {
+        free(grau); free(ordem); free(atual); free(seguinte);
+        return 0;
+    }
+    // Ordem topológica (Kahn) só com os vértices úteis
+    int numUteis = 0;
+    for (int v = 0; v < m; v++) {
+        if (!sg->util[v]) continue;
+        numUteis++;
+        for (int e = sg->inicio[v]; e < sg->inicio[v + 1]; e++) {
+            if (sg->util[sg->vizinhos[e]]) grau[sg->vizinhos[e]]++;
+        }
+    }
+    int n = 0;
+    for (int v = 0; v < m; v++) {
+        if (sg->util[v] && grau[v] == 0) ordem[n++] = v;
+    }
+    for (int i = 0; i < n; i++) {
+        int v = ordem[i];
+        for (int e = sg->inicio[v]; e < sg->inicio[v + 1]; e++) {
+            int w = sg->vizinhos[e];
+            if (sg->util[w] && --grau[w] == 0) ordem[n++] = w;
+        }
+    }
+    int semCiclos = n == numUteis;
+    if (semCiclos && maxComprimento <= 0) {
+        atual[sg->destino] = 1;
+        for (int i = n - 1; i >= 0; i--) {
+            int v = ordem[i];
+            if (v == sg->destino) continue;
+            unsigned long long soma = 0;
+            for (int e = sg->inicio[v]; e < sg->inicio[v + 1]; e++) {
+                if (sg->util[sg->vizinhos[e]]) soma = somarContagem(soma, atual[sg->vizinhos[e]], saturado);
+            }
+            atual[v] = soma;
+        }
+        *total = atual[sg->origem];
+    } else if (semCiclos) {
+        // Num grafo sem ciclos nenhum caminho tem mais de numUteis - 1 arestas
+        int maxL = maxComprimento < numUteis - 1 ? maxComprimento : numUteis - 1;
+        unsigned long long soma = 0;
+        atual[sg->destino] = 1;
+        for (int l = 1; l <= maxL; l++) {
+            for (int v = 0; v < m; v++) {
+                seguinte[v] = 0;
+                if (!sg->util[v] || v == sg->destino) continue;
+                for (int e = sg->inicio[v]; e < sg->inicio[v + 1]; e++) {
+                    seguinte[v] = somarContagem(seguinte[v], atual[sg->vizinhos[e]], saturado);
+                }
+            }
+            soma = somarContagem(soma, seguinte[sg->origem], saturado);
+            unsigned long long* t = atual;
+            atual = seguinte;
+            seguinte = t;
+        }
+        *total = soma;
+    }
+    free(grau);
+    free(ordem);
+    free(atual);
+    free(seguinte);
+    return semCiclos;
+}
+#pragma endregion
+#pragma region Enumeração
+/**
+ * @brief Guarda um caminho no resultado.
+ *
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int guardarCaminho(ResultadoCaminhos* r, SubgrafoCaminhos* sg, const int* pilha, int tamanho) {
+    if (r->numCaminhos + 1 >= r->capacidadeCaminhos) {
+        int capacidade = r->capacidadeCaminhos ? r->capacidadeCaminhos * 2 : 16;
+        int* inicio = (int*)realloc(r->inicio, (size_t)capacidade * sizeof(int));
+        if (!inicio) return 0;
+        r->inicio = inicio;
+        r->capacidadeCaminhos = capacidade;
+    }
+    int usados = r->numCaminhos > 0 ? r->inicio[r->numCaminhos] : 0;
+    if (usados + tamanho > r->capacidadeVertices) {
+        int capacidade = r->capacidadeVertices ? r->capacidadeVertices : 64;
+        while (capacidade < usados + tamanho) capacidade *= 2;
+        Vertice** vertices = (Vertice**)realloc(r->vertices, (size_t)capacidade * sizeof(Vertice*));
+        if (!vertices) return 0;
+        r->vertices = vertices;
+        r->capacidadeVertices = capacidade;
+    }
+    if (r->numCaminhos == 0) r->inicio[0] = 0;
+    for (int i = 0; i < tamanho; i++) {
+        r->vertices[usados + i] = sg->vertices[pilha[i]];
+    }
+    r->numCaminhos++;
+    r->inicio[r->numCaminhos] = usados + tamanho;
+    return 1;
+}
+
+/**
+ * @brief Percorre os caminhos um a um, pela mesma ordem que encontrarCaminhos.
+ *
+ * Só entra em vértices úteis (os outros nunca chegam ao destino), não passa do
+ * comprimento máximo e para assim que encontrar consulta.maxCaminhos caminhos.
+ *
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int enumerarCaminhos(SubgrafoCaminhos* sg, ConsultaCaminhos consulta, ResultadoCaminhos* r) {
+    int m = sg->m;
+    int* pilha = (int*)malloc((size_t)m * sizeof(int));
+    int* seguinte = (int*)malloc((size_t)m * sizeof(int));
+    char* noCaminho = (char*)calloc((size_t)m, 1);
+    if (!pilha || !seguinte || !noCaminho) {
+        free(pilha); free(seguinte); free(noCaminho);
+        return 0;
+    }
+    int topo = 0, ok = 1;
+    pilha[topo] = sg->origem;
+    seguinte[topo++] = sg->inicio[sg->origem];
+    noCaminho[sg->origem] = 1;
+    while (topo > 0) {
+        int v = pilha[topo - 1];
+        if (v == sg->destino) {
+            r->total = somarContagem(r->total, 1, &r->saturado);
+            if (consulta.guardarCaminhos && !guardarCaminho(r, sg, pilha, topo)) {
+                ok = 0;
+                break;
+            }
+            if (consulta.maxCaminhos > 0 && r->total >= (unsigned long long)consulta.maxCaminhos) {
+                r->completo = 0;  // Paragem antecipada
+                break;
+            }
+            noCaminho[v] = 0;
+            topo--;
+            continue;
+        }
+        if (seguinte[topo - 1] == sg->inicio[v + 1] ||
+            (consulta.maxComprimento > 0 && topo - 1 >= consulta.maxComprimento)) {
+            noCaminho[v] = 0;
+            topo--;
+            continue;
+        }
+        int w = sg->vizinhos[seguinte[topo - 1]++];
+        if (!noCaminho[w] && sg->util[w]) {
+            noCaminho[w] = 1;
+            pilha[topo] = w;
+            seguinte[topo++] = sg->inicio[w];
+        }
+    }
+    free(pilha);
+    free(seguinte);
+    free(noCaminho);
+    return ok;
+}
+#pragma endregion
+#pragma region Procurar Caminhos
+/**
+ * @brief Procura os caminhos simples entre duas antenas, com limites e sem imprimir.
+ *
+ * Considera os mesmos caminhos que encontrarCaminhos (cada vértice no máximo uma vez,
+ * terminando no destino), mas:
+ * - só percorre a parte do grafo alcançável a partir da origem e que chega ao destino;
+ * - se só for pedida a contagem, usa uma fórmula fechada quando o subgrafo é completo
+ *   (caso normal de uma frequência, em que há um número fatorial de caminhos) ou
+ *   programação dinâmica quando não tem ciclos; só nos outros casos os caminhos são
+ *   percorridos um a um;
+ * - para ao fim de consulta.maxCaminhos caminhos e não segue caminhos com mais de
+ *   consulta.maxComprimento arestas.
+ *
+ * @param origem Apontador para o vértice de partida.
+ * @param destino Apontador para o vértice de destino.
+ * @param consulta Limites da consulta (0 = sem limite) e se os caminhos devem ser guardados.
+ * @return Resultado (libertar com libertarCaminhos), ou NULL em caso de erro de memória.
+ */
+ResultadoCaminhos* procurarCaminhos(Vertice* origem, Vertice* destino, ConsultaCaminhos consulta) {
+    ResultadoCaminhos* r = (ResultadoCaminhos*)calloc(1, sizeof(ResultadoCaminhos));
+    if (!r) {
+        printf("Erro ao alocar memória para os caminhos!\n");
+        return NULL;
+    }
+    r->completo = 1;
+    r->metodo = CONTAGEM_TRIVIAL;
+    if (!origem || !destino) return r;
+    if (origem == destino) {
+        // O único caminho é o próprio vértice (tal como em encontrarCaminhos)
+        r->total = 1;
+        int zero = 0;
+        SubgrafoCaminhos sg;
+        sg.vertices = &origem;
+        if (consulta.guardarCaminhos && !guardarCaminho(r, &sg, &zero, 1)) {
+            libertarCaminhos(r);
+            return NULL;
+        }
+        return r;
+    }
+    SubgrafoCaminhos sg;
+    if (!construirSubgrafo(origem, destino, &sg)) {
+        printf("Erro ao alocar memória para os caminhos!\n");
+        libertarCaminhos(r);
+        return NULL;
+    }
+    if (sg.destino < 0 || !sg.util[sg.origem]) {
+        libertarSubgrafo(&sg);
+        return r;
+    }
+    int ok = 1;
+    if (!consulta.guardarCaminhos && contarCaminhosClique(&sg, consulta.maxComprimento, &r->total, &r->saturado)) {
+        r->metodo = CONTAGEM_CLIQUE;
+    } else if (!consulta.guardarCaminhos && contarCaminhosDAG(&sg, consulta.maxComprimento, &r->total, &r->saturado)) {
+        r->metodo = CONTAGEM_DAG;
+    } else {
+        r->metodo = CONTAGEM_ENUMERACAO;
+        ok = enumerarCaminhos(&sg, consulta, r);
+    }
+    if (r->metodo != CONTAGEM_ENUMERACAO && consulta.maxCaminhos > 0 &&
+        r->total > (unsigned long long)consulta.maxCaminhos) {
+        r->total = (unsigned long long)consulta.maxCaminhos;
+        r->completo = 0;
+        r->saturado = 0;
+    }
+    libertarSubgrafo(&sg);
+    if (!ok) {
+        printf("Erro ao alocar memória para os caminhos!\n");
+        libertarCaminhos(r);
+        return NULL;
+    }
+    return r;
+}
+
+/**
+ * @brief Conta os caminhos simples entre duas antenas sem os guardar nem imprimir.
+ *
+ * @param origem Apontador para o vértice de partida.
+ * @param destino Apontador para o vértice de destino.
+ * @param maxComprimento Número máximo de arestas (0 = sem limite).
+ * @return Número de caminhos (ULLONG_MAX se não couber), ou 0 em caso de erro.
+ */
+unsigned long long contarCaminhos(Vertice* origem, Vertice* destino, int maxComprimento) {
+    ConsultaCaminhos consulta = { 0, maxComprimento, 0 };
+    ResultadoCaminhos* r = procurarCaminhos(origem, destino, consulta);
+    if (!r) return 0;
+    unsigned long long total = r->total;
+    libertarCaminhos(r);
+    return total;
+}
+#pragma endregion
+#pragma region Numeração Local
+/**
+ * @brief Números locais (0, 1, 2, ...) dados aos vértices à medida que são encontrados.
+ *
+ * O número fica no campo "id" do vértice e o valor anterior é guardado para ser reposto
+ * no fim; a época (novaEpocaPesquisa) indica se o vértice já foi numerado nesta pesquisa.
+ * Os vetores por vértice crescem com a numeração, por isso uma pesquisa que pare cedo
+ * (ex: A*) só usa memória para a parte do grafo que visitou.
+ */
+typedef struct numeracaoLocal {
+    unsigned int epoca;
+    int total;
+    int capacidade;
+    Vertice** vertices;          // Vértice de cada número
+    int* idAnterior;             // Valor do campo "id" antes da pesquisa
+    int* anterior;               // Número do vértice anterior no melhor caminho (-1 = nenhum)
+    double* custo;               // Melhor custo conhecido desde a origem
+    char* fechado;               // 1 se o custo já é definitivo
+} NumeracaoLocal;
+
+/**
+ * @brief Devolve o número local de um vértice, numerando-o se for a primeira vez.
+ *
+ * @return Número do vértice, ou -1 em caso de erro de memória.
+ */
+static int numeroLocal(NumeracaoLocal* nl, Vertice* v) {
+    if (v->epoca == nl->epoca) return v->id;
+    if (nl->total == nl->capacidade) {
+        int capacidade = nl->capacidade ? nl->capacidade * 2 : 64;
+        Vertice** vertices = (Vertice**)realloc(nl->vertices, (size_t)capacidade * sizeof(Vertice*));
+        if (vertices) nl->vertices = vertices;
+        int* idAnterior = (int*)realloc(nl->idAnterior, (size_t)capacidade * sizeof(int));
+        if (idAnterior) nl->idAnterior = idAnterior;
+        int* anterior = (int*)realloc(nl->anterior, (size_t)capacidade * sizeof(int));
+        if (anterior) nl->anterior = anterior;
+        double* custo = (double*)realloc(nl->custo, (size_t)capacidade * sizeof(double));
+        if (custo) nl->custo = custo;
+        char* fechado = (char*)realloc(nl->fechado, (size_t)capacidade);
+        if (fechado) nl->fechado = fechado;
+        if (!vertices || !idAnterior || !anterior || !custo || !fechado) return -1;
+        nl->capacidade = capacidade;
+    }
+    int n = nl->total++;
+    nl->vertices[n] = v;
+    nl->idAnterior[n] = v->id;
+    nl->anterior[n] = -1;
+    nl->custo[n] = -1.0;
+    nl->fechado[n] = 0;
+    v->epoca = nl->epoca;
+    v->id = n;
+    return n;
+}
+
+/**
+ * @brief Repõe o campo "id" dos vértices numerados e liberta a numeração.
+ */
+static void libertarNumeracao(NumeracaoLocal* nl) {
+    for (int i = 0; i < nl->total; i++) {
+        nl->vertices[i]->id = nl->idAnterior[i];
+    }
+    free(nl->vertices);
+    free(nl->idAnterior);
+    free(nl->anterior);
+    free(nl->custo);
+    free(nl->fechado);
+}
+
+/**
+ * @brief Cria o resultado a partir dos vértices anteriores guardados na numeração.
+ *
+ * @param nl Numeração da pesquisa.
+ * @param destino Número do destino (-1 se não foi alcançado).
+ * @param expandidos Vértices retirados da fila.
+ * @return Caminho (vazio se o destino não foi alcançado), ou NULL em caso de erro de memória.
+ */
+static CaminhoMinimo* construirCaminhoMinimo(NumeracaoLocal* nl, int destino, int expandidos) {
+    CaminhoMinimo* c = (CaminhoMinimo*)calloc(1, sizeof(CaminhoMinimo));
+    if (!c) return NULL;
+    c->custo = -1.0;
+    c->expandidos = expandidos;
+    if (destino < 0) return c;
+    int n = 0;
+    for (int v = destino; v >= 0; v = nl->anterior[v]) n++;
+    c->vertices = (Vertice**)malloc((size_t)n * sizeof(Vertice*));
+    if (!c->vertices) {
+        free(c);
+        return NULL;
+    }
+    int i = n;
+    for (int v = destino; v >= 0; v = nl->anterior[v]) c->vertices[--i] = nl->vertices[v];
+    c->numVertices = n;
+    c->custo = nl->custo[destino];
+    return c;
+}
+#pragma endregion
+#pragma region Caminho Mais Curto
+/**
+ * @brief Encontra o caminho com menos arestas entre duas antenas (BFS).
+ *
+ * A pesquisa para assim que o destino é encontrado. O custo é o número de arestas.
+ *
+ * @param origem Apontador para o vértice de partida.
+ * @param destino Apontador para o vértice de destino.
+ * @return Caminho encontrado (numVertices = 0 se não houver), ou NULL em caso de erro.
+ */
+CaminhoMinimo* caminhoMaisCurtoBFS(Vertice* origem, Vertice* destino) {
+    NumeracaoLocal nl = { novaEpocaPesquisa(), 0, 0, NULL, NULL, NULL, NULL, NULL };
+    int encontrado = -1, expandidos = 0, erro = 0;
+    if (origem && destino) {
+        int o = numeroLocal(&nl, origem);
+        if (o < 0) erro = 1;
+        else nl.custo[o] = 0;
+        // A fila é a própria numeração: os vértices são numerados pela ordem em que entram
+        for (int i = 0; i < nl.total && !erro && encontrado < 0; i++) {
+            expandidos++;
+            if (nl.vertices[i] == destino) {
+                encontrado = i;
+                break;
+            }
+            for (AdjD* adj = nl.vertices[i]->adjacencias; adj; adj = adj->next) {
+                if (!adj->destino || adj->destino->epoca == nl.epoca) continue;
+                int w = numeroLocal(&nl, adj->destino);
+                if (w < 0) {
+                    erro = 1;
+                    break;
+                }
+                nl.custo[w] = nl.custo[i] + 1;
+                nl.anterior[w] = i;
+            }
+        }
+    }
+    CaminhoMinimo* c = erro ? NULL : construirCaminhoMinimo(&nl, encontrado, expandidos);
+    libertarNumeracao(&nl);
+    if (!c) printf("Erro ao alocar memória para o caminho!\n");
+    return c;
+}
+
+/**
+ * @brief Peso de uma aresta entre duas antenas.
+ */
+static double pesoAresta(Vertice* a, Vertice* b, TipoPeso peso) {
+    double dx = (double)a->x - (double)b->x;
+    double dy = (double)a->y - (double)b->y;
+    switch (peso) {
+        case PESO_MANHATTAN: return fabs(dx) + fabs(dy);
+        case PESO_EUCLIDIANO: return sqrt(dx * dx + dy * dy);
+        default: return 1.0;
+    }
+}
+
+/**
+ * @brief Entrada do heap: vértice e prioridade (custo + estimativa).
+ */
+typedef struct entradaHeap {
+    double prioridade;
+    int vertice;
+} EntradaHeap;
+
+/**
+ * @brief Heap binário de mínimos. As entradas desatualizadas (vértices já fechados)
+ * são ignoradas quando saem, em vez de se alterar a prioridade no heap.
+ */
+typedef struct heapMinimo {
+    EntradaHeap* entradas;
+    int total;
+    int capacidade;
+} HeapMinimo;
+
+/**
+ * @brief Acrescenta uma entrada ao heap.
+ *
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int inserirHeap(HeapMinimo* h, double prioridade, int vertice) {
+    if (h->total == h->capacidade) {
+        int capacidade = h->capacidade ? h->capacidade * 2 : 64;
+        EntradaHeap* entradas = (EntradaHeap*)realloc(h->entradas, (size_t)capacidade * sizeof(EntradaHeap));
+        if (!entradas) return 0;
+        h->entradas = entradas;
+        h->capacidade = capacidade;
+    }
+    int i = h->total++;
+    while (i > 0 && h->entradas[(i - 1) / 2].prioridade > prioridade) {
+        h->entradas[i] = h->entradas[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    h->entradas[i].prioridade = prioridade;
+    h->entradas[i].vertice = vertice;
+    return 1;
+}
+
+/**
+ * @brief Retira a entrada com menor prioridade (o heap não pode estar vazio).
+ */
+static EntradaHeap retirarHeap(HeapMinimo* h) {
+    EntradaHeap topo = h->entradas[0];
+    EntradaHeap ultima = h->entradas[--h->total];
+    int i = 0;
+    for (;;) {
+        int filho = 2 * i + 1;
+        if (filho >= h->total) break;
+        if (filho + 1 < h->total && h->entradas[filho + 1].prioridade < h->entradas[filho].prioridade) filho++;
+        if (h->entradas[filho].prioridade >= ultima.prioridade) break;
+        h->entradas[i] = h->entradas[filho];
+        i = filho;
+    }
+    if (h->total > 0) h->entradas[i] = ultima;
+    return topo;
+}
+
+/**
+ * @brief Pesquisa de menor custo comum ao Dijkstra e ao A*.
+ *
+ * Com estimativa, a prioridade de cada vértice é o custo desde a origem mais a distância
+ * (com a mesma métrica das arestas) até ao destino. Como o peso de cada aresta é essa
+ * mesma distância entre as suas antenas, a estimativa nunca excede o custo real e
+ * respeita a desigualdade triangular, por isso o caminho devolvido continua a ser ótimo.
+ *
+ * @param origem Vértice de partida.
+ * @param destino Vértice de destino.
+ * @param peso Peso das arestas.
+ * @param usarEstimativa 1 para A*, 0 para Dijkstra.
+ * @return Caminho encontrado, ou NULL em caso de erro de memória.
+ */
+static CaminhoMinimo* pesquisaMenorCusto(Vertice* origem, Vertice* destino, TipoPeso peso, int usarEstimativa) {
+    NumeracaoLocal nl = { novaEpocaPesquisa(), 0, 0, NULL, NULL, NULL, NULL, NULL };
+    HeapMinimo heap = { NULL, 0, 0 };
+    int encontrado = -1, expandidos = 0, erro = 0;
+    // Com PESO_SALTOS a distância não dá informação útil e o A* é igual ao Dijkstra
+    usarEstimativa = usarEstimativa && peso != PESO_SALTOS;
+    if (origem && destino) {
+        int o = numeroLocal(&nl, origem);
+        erro = o < 0;
+        if (!erro) {
+            nl.custo[o] = 0;
+            erro = !inserirHeap(&heap, usarEstimativa ? pesoAresta(origem, destino, peso) : 0, o);
+        }
+        while (heap.total > 0 && !erro) {
+            int v = retirarHeap(&heap).vertice;
+            if (nl.fechado[v]) continue;  // Entrada desatualizada
+            nl.fechado[v] = 1;
+            expandidos++;
+            if (nl.vertices[v] == destino) {
+                encontrado = v;
+                break;
+            }
+            for (AdjD* adj = nl.vertices[v]->adjacencias; adj; adj = adj->next) {
+                if (!adj->destino) continue;
+                int w = numeroLocal(&nl, adj->destino);
+                if (w < 0) {
+                    erro = 1;
+                    break;
+                }
+                if (nl.fechado[w]) continue;
+                double custo = nl.custo[v] + pesoAresta(nl.vertices[v], adj->destino, peso);
+                if (nl.custo[w] < 0 || custo < nl.custo[w]) {
+                    nl.custo[w] = custo;
+                    nl.anterior[w] = v;
+                    double prioridade = custo + (usarEstimativa ? pesoAresta(adj->destino, destino, peso) : 0);
+                    if (!inserirHeap(&heap, prioridade, w)) {
+                        erro = 1;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    CaminhoMinimo* c = erro ? NULL : construirCaminhoMinimo(&nl, encontrado, expandidos);
+    free(heap.entradas);
+    libertarNumeracao(&nl);
+    if (!c) printf("Erro ao alocar memória para o caminho!\n");
+    return c;
+}
+
+/**
+ * @brief Encontra o caminho de menor custo entre duas antenas (algoritmo de Dijkstra).
+ *
+ * O peso de cada aresta é calculado a partir das coordenadas das duas antenas
+ * (ver TipoPeso). Usa um heap binário e para quando o destino sai do heap.
+ *
+ * @param origem Apontador para o vértice de partida.
+ * @param destino Apontador para o vértice de destino.
+ * @param peso Peso das arestas.
+ * @return Caminho encontrado (numVertices = 0 se não houver), ou NULL em caso de erro.
+ */
+CaminhoMinimo* caminhoMaisCurtoDijkstra(Vertice* origem, Vertice* destino, TipoPeso peso) {
+    return pesquisaMenorCusto(origem, destino, peso, 0);
+}
+
+/**
+ * @brief Encontra o caminho de menor custo entre duas antenas (algoritmo A*).
+ *
+ * Dá o mesmo custo que caminhoMaisCurtoDijkstra, mas a distância de cada antena ao
+ * destino orienta a pesquisa, que normalmente expande muito menos vértices.
+ *
+ * @param origem Apontador para o vértice de partida.
+ * @param destino Apontador para o vértice de destino.
+ * @param peso Peso das arestas.
+ * @return Caminho encontrado (numVertices = 0 se não houver), ou NULL em caso de erro.
+ */
+CaminhoMinimo* caminhoMaisCurtoAEstrela(Vertice* origem, Vertice* destino, TipoPeso peso) {
+    return pesquisaMenorCusto(origem, destino, peso, 1);
+}
+#pragma endregion
+#pragma region Imprimir e Libertar
+/**
+ * @brief Imprime os caminhos guardados num resultado, um por linha (como encontrarCaminhos).
+ *
+ * @param r Resultado da consulta.
+ * @return Número de caminhos impressos.
+ */
+int imprimirCaminhos(ResultadoCaminhos* r) {
+    if (!r) return 0;
+    for (int i = 0; i < r->numCaminhos; i++) {
+        imprimirCaminho(r->vertices + r->inicio[i], r->inicio[i + 1] - r->inicio[i]);
+    }
+    return r->numCaminhos;
+}
+
+/**
+ * @brief Liberta a memória de um resultado.
+ *
+ * @param r Resultado da consulta.
+ * @return 0 em caso de sucesso.
+ */
+int libertarCaminhos(ResultadoCaminhos* r) {
+    if (!r) return 0;
+    free(r->inicio);
+    free(r->vertices);
+    free(r);
+    return 0;
+}
+
+/**
+ * @brief Imprime um caminho mais curto e o seu custo.
+ *
+ * @param c Caminho.
+ * @return 1 se havia caminho, 0 caso contrário.
+ */
+int imprimirCaminhoMinimo(CaminhoMinimo* c) {
+    if (!c || c->numVertices == 0) {
+        printf("Não existe caminho entre as antenas.\n");
+        return 0;
+    }
+    imprimirCaminho(c->vertices, c->numVertices);
+    printf("Custo: %.2f\n", c->custo);
+    return 1;
+}
+
+/**
+ * @brief Liberta a memória de um caminho mais curto.
+ *
+ * @param c Caminho.
+ * @return 0 em caso de sucesso.
+ */
+int libertarCaminhoMinimo(CaminhoMinimo* c) {
+    if (!c) return 0;
+    free(c->vertices);
+    free(c);
+    return 0;
+}
+#pragma endregion
@@ -0,0 +1,145 @@
+/**
+ * @file caminhos.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Consulta de caminhos entre antenas com contagem, limite de caminhos e de comprimento
+ * @version 0.1
+ * @date 2025-06-01
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef CAMINHOS_H
+#define CAMINHOS_H
+
+#include "grafo.h"
+
+/**
+ * @brief Limites de uma consulta de caminhos.
+ */
+typedef struct consultaCaminhos {
+    int maxCaminhos;             // Parar depois de encontrar este número de caminhos (0 = sem limite)
+    int maxComprimento;          // Número máximo de arestas de cada caminho (0 = sem limite)
+    int guardarCaminhos;         // 1 para guardar os caminhos no resultado, 0 para só contar
+} ConsultaCaminhos;
+
+/**
+ * @brief Forma como o número de caminhos foi obtido.
+ */
+typedef enum metodoContagem {
+    CONTAGEM_TRIVIAL,            // Origem igual ao destino, ou destino inalcançável
+    CONTAGEM_CLIQUE,             // Subgrafo completo: fórmula fechada
+    CONTAGEM_DAG,                // Subgrafo sem ciclos: programação dinâmica
+    CONTAGEM_ENUMERACAO          // Pesquisa em profundidade caminho a caminho
+} MetodoContagem;
+
+/**
+ * @brief Resultado de uma consulta de caminhos.
+ *
+ * Os caminhos guardados estão seguidos no vetor "vertices": o caminho i ocupa as posições
+ * inicio[i] até inicio[i + 1] - 1, pela mesma ordem em que encontrarCaminhos os imprime.
+ */
+typedef struct resultadoCaminhos {
+    unsigned long long total;    // Número de caminhos (até maxCaminhos, se houver limite)
+    int completo;                // 1 se total é o número exato de caminhos, 0 se a consulta parou antes
+    int saturado;                // 1 se o número de caminhos não cabe em unsigned long long
+    MetodoContagem metodo;
+    int numCaminhos;             // Caminhos guardados
+    int* inicio;                 // Início de cada caminho guardado (numCaminhos + 1)
+    Vertice** vertices;          // Vértices dos caminhos guardados
+    int capacidadeCaminhos;
+    int capacidadeVertices;
+} ResultadoCaminhos;
+
+/**
+ * @brief Procura os caminhos simples entre duas antenas com os limites indicados
+ * @param origem Vértice de partida
+ * @param destino Vértice de destino
+ * @param consulta Limites da consulta
+ * @return Resultado da consulta, ou NULL em caso de erro de memória
+ */
+ResultadoCaminhos* procurarCaminhos(Vertice* origem, Vertice* destino, ConsultaCaminhos consulta);
+
+/**
+ * @brief Conta os caminhos simples entre duas antenas
+ * @param origem Vértice de partida
+ * @param destino Vértice de destino
+ * @param maxComprimento Número máximo de arestas (0 = sem limite)
+ * @return Número de caminhos (ULLONG_MAX se não couber), ou 0 em caso de erro
+ */
+unsigned long long contarCaminhos(Vertice* origem, Vertice* destino, int maxComprimento);
+
+/**
+ * @brief Imprime os caminhos guardados num resultado
+ * @param r Resultado da consulta
+ * @return Número de caminhos impressos
+ */
+int imprimirCaminhos(ResultadoCaminhos* r);
+
+/**
+ * @brief Liberta a memória de um resultado
+ * @param r Resultado da consulta
+ * @return 0 em caso de sucesso
+ */
+int libertarCaminhos(ResultadoCaminhos* r);
+
+/**
+ * @brief Peso de cada aresta nas consultas de caminho mais curto.
+ */
+typedef enum tipoPeso {
+    PESO_SALTOS,                 // Cada aresta vale 1
+    PESO_MANHATTAN,              // |dx| + |dy| entre as duas antenas
+    PESO_EUCLIDIANO              // Distância em linha reta entre as duas antenas
+} TipoPeso;
+
+/**
+ * @brief Caminho mais curto entre duas antenas.
+ */
+typedef struct caminhoMinimo {
+    double custo;                // Soma dos pesos das arestas (-1 se não houver caminho)
+    int numVertices;             // Vértices do caminho (0 se não houver caminho)
+    Vertice** vertices;          // Vértices pela ordem do percurso
+    int expandidos;              // Vértices retirados da fila durante a pesquisa
+} CaminhoMinimo;
+
+/**
+ * @brief Caminho com menos arestas entre duas antenas (BFS)
+ * @param origem Vértice de partida
+ * @param destino Vértice de destino
+ * @return Caminho encontrado, ou NULL em caso de erro de memória
+ */
+CaminhoMinimo* caminhoMaisCurtoBFS(Vertice* origem, Vertice* destino);
+
+/**
+ * @brief Caminho de menor custo entre duas antenas (Dijkstra com heap binário)
+ * @param origem Vértice de partida
+ * @param destino Vértice de destino
+ * @param peso Peso das arestas
+ * @return Caminho encontrado, ou NULL em caso de erro de memória
+ */
+CaminhoMinimo* caminhoMaisCurtoDijkstra(Vertice* origem, Vertice* destino, TipoPeso peso);
+
+/**
+ * @brief Caminho de menor custo entre duas antenas (A* com a distância ao destino como estimativa)
+ * @param origem Vértice de partida
+ * @param destino Vértice de destino
+ * @param peso Peso das arestas
+ * @return Caminho encontrado, ou NULL em caso de erro de memória
+ */
+CaminhoMinimo* caminhoMaisCurtoAEstrela(Vertice* origem, Vertice* destino, TipoPeso peso);
+
+/**
+ * @brief Imprime um caminho mais curto e o seu custo
+ * @param c Caminho
+ * @return 1 se havia caminho, 0 caso contrário
+ */
+int imprimirCaminhoMinimo(CaminhoMinimo* c);
+
+/**
+ * @brief Liberta a memória de um caminho mais curto
+ * @param c Caminho
+ * @return 0 em caso de sucesso
+ */
+int libertarCaminhoMinimo(CaminhoMinimo* c);
+
+#endif
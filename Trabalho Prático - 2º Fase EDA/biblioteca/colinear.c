@@ -0,0 +1,417 @@
+/**
+ * @file colinear.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da procura de antenas alinhadas em qualquer direção
+ * @version 0.1
+ * @date 2025-06-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "colinear.h"
+#include "indice.h"
+#include "paralelo.h"
+
+#define COLINEAR_ANTENAS_TAREFA 256    // Antenas de referência por tarefa
+
+/**
+ * @brief Entrada da tabela de direções de uma antena de referência.
+ */
+typedef struct entradaDirecao {
+    int dx, dy;                  // Direção normalizada
+    unsigned int marca;          // Antena de referência que usou a entrada (entrada livre se for outra)
+    int contagem;                // Antenas nessa direção
+    int antes;                   // 1 se alguma delas estiver antes da referência (a reta já foi vista)
+    int destino;                 // Posição onde ficam as antenas da reta (-1 se não for guardada)
+} EntradaDirecao;
+
+/**
+ * @brief Memória de trabalho de uma thread (reutilizada para todas as antenas de referência).
+ */
+typedef struct trabalhoColinear {
+    EntradaDirecao* tabela;
+    unsigned int mascara;
+    unsigned int marca;
+    int* entrada;                // Entrada da tabela de cada antena do grupo
+    int* usadas;                 // Entradas usadas pela antena de referência atual
+} TrabalhoColinear;
+
+/**
+ * @brief Resultado de uma tarefa (juntado no fim pela ordem das tarefas).
+ */
+typedef struct resultadoTarefa {
+    RetaAntenas* retas;
+    int numRetas, capacidadeRetas;
+    Coordenada* antenas;
+    int numAntenas, capacidadeAntenas;
+    long long numPares;
+    ConjuntoEfeitos* efeitos;
+    int erro;
+} ResultadoTarefa;
+
+/**
+ * @brief Dados partilhados pelas tarefas de calcularColineares.
+ */
+typedef struct contextoColinear {
+    Coordenada* antenas;         // Todas as antenas, por (frequência, x, y)
+    int inicio[257];             // Início de cada frequência em "antenas"
+    int minimo;
+    int* tarefaFrequencia;       // Frequência de cada tarefa
+    int* tarefaInicio;           // Primeira antena de referência de cada tarefa
+    TrabalhoColinear* trabalho;  // Um por thread
+    ResultadoTarefa* resultados; // Um por tarefa
+} ContextoColinear;
+
+#pragma region Auxiliares
+/**
+ * @brief Compara coordenadas por (x, y).
+ */
+static int compararXY(const void* a, const void* b) {
+    const Coordenada* p = (const Coordenada*)a;
+    const Coordenada* q = (const Coordenada*)b;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    return (p->y > q->y) - (p->y < q->y);
+}
+
+/**
+ * @brief Máximo divisor comum de dois números não negativos.
+ */
+static int mdc(int a, int b) {
+    while (b) {
+        int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/**
+ * @brief Procura (ou cria) a entrada da direção (dx, dy) na tabela da antena de referência atual.
+ *
+ * @return Posição da entrada na tabela.
+ */
+static int entradaDaDirecao(TrabalhoColinear* w, int dx, int dy, int* numUsadas) {
+    unsigned int p = dispersaoPosicao(dx, dy) & w->mascara;
+    while (w->tabela[p].marca == w->marca) {
+        if (w->tabela[p].dx == dx && w->tabela[p].dy == dy) return (int)p;
+        p = (p + 1) & w->mascara;
+    }
+    EntradaDirecao* e = &w->tabela[p];
+    e->dx = dx;
+    e->dy = dy;
+    e->marca = w->marca;
+    e->contagem = 0;
+    e->antes = 0;
+    e->destino = -1;
+    w->usadas[(*numUsadas)++] = (int)p;
+    return (int)p;
+}
+
+/**
+ * @brief Reserva espaço para mais "extra" antenas no resultado da tarefa.
+ */
+static int reservarAntenas(ResultadoTarefa* r, int extra) {
+    if (r->numAntenas + extra <= r->capacidadeAntenas) return 1;
+    int capacidade = r->capacidadeAntenas ? r->capacidadeAntenas : 64;
+    while (capacidade < r->numAntenas + extra) capacidade *= 2;
+    Coordenada* antenas = (Coordenada*)realloc(r->antenas, (size_t)capacidade * sizeof(Coordenada));
+    if (!antenas) return 0;
+    r->antenas = antenas;
+    r->capacidadeAntenas = capacidade;
+    return 1;
+}
+
+/**
+ * @brief Acrescenta uma reta (sem as antenas) ao resultado da tarefa.
+ */
+static RetaAntenas* novaReta(ResultadoTarefa* r) {
+    if (r->numRetas == r->capacidadeRetas) {
+        int capacidade = r->capacidadeRetas ? r->capacidadeRetas * 2 : 16;
+        RetaAntenas* retas = (RetaAntenas*)realloc(r->retas, (size_t)capacidade * sizeof(RetaAntenas));
+        if (!retas) return NULL;
+        r->retas = retas;
+        r->capacidadeRetas = capacidade;
+    }
+    return &r->retas[r->numRetas++];
+}
+#pragma endregion
+#pragma region Retas de uma Antena
+/**
+ * @brief Processa uma antena de referência: agrupa as outras antenas do grupo por direção.
+ *
+ * A direção para cada antena é dividida pelo máximo divisor comum e posta com dx > 0
+ * (ou dx == 0 e dy > 0), por isso as antenas da mesma reta que passa pela referência
+ * ficam na mesma entrada da tabela de dispersão, de um lado ou do outro. Como o grupo
+ * está ordenado por (x, y), as antenas depois da referência estão todas no sentido da
+ * direção normalizada; uma reta só é guardada pela sua primeira antena (nenhuma antena
+ * antes da referência na mesma direção), por isso cada reta aparece uma única vez.
+ *
+ * O ponto médio de um par é inteiro quando o divisor comum das diferenças é par; cada
+ * par é contado uma vez, a partir da antena que aparece primeiro.
+ *
+ * @param ctx Contexto.
+ * @param w Memória de trabalho da thread.
+ * @param r Resultado da tarefa.
+ * @param grupo Antenas da frequência.
+ * @param num Número de antenas do grupo.
+ * @param i Posição da antena de referência no grupo.
+ * @param frequencia Frequência do grupo.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int retasDaAntena(ContextoColinear* ctx, TrabalhoColinear* w, ResultadoTarefa* r,
+                         const Coordenada* grupo, int num, int i, char frequencia) {
+    const Coordenada* a = &grupo[i];
+    int numUsadas = 0;
+    w->marca++;
+    if (w->marca == 0) {  // A marca deu a volta: limpar a tabela
+        memset(w->tabela, 0, (size_t)(w->mascara + 1) * sizeof(EntradaDirecao));
+        w->marca = 1;
+    }
+    for (int j = 0; j < num; j++) {
+        if (j == i) continue;
+        int dx = grupo[j].x - a->x;
+        int dy = grupo[j].y - a->y;
+        int g = mdc(dx < 0 ? -dx : dx, dy < 0 ? -dy : dy);
+        if (g == 0) continue;  // Antena repetida
+        int px = dx / g, py = dy / g;
+        int antes = j < i;
+        if (px < 0 || (px == 0 && py < 0)) {
+            px = -px;
+            py = -py;
+        }
+        int e = entradaDaDirecao(w, px, py, &numUsadas);
+        w->tabela[e].contagem++;
+        w->tabela[e].antes |= antes;
+        w->entrada[j] = e;
+        if (!antes) {
+            r->numPares++;
+            if (g % 2 == 0) {
+                char direcao = px == 0 ? DIRECAO_MESMO_X : (py == 0 ? DIRECAO_MESMO_Y : DIRECAO_DIAGONAL);
+                if (adicionarEfeito(r->efeitos, a->x + dx / 2, a->y + dy / 2, direcao) < 0) return -1;
+            }
+        }
+    }
+    // Retas que começam nesta antena e têm antenas suficientes
+    for (int k = 0; k < numUsadas; k++) {
+        EntradaDirecao* e = &w->tabela[w->usadas[k]];
+        if (e->antes || e->contagem + 1 < ctx->minimo) continue;
+        if (!reservarAntenas(r, e->contagem + 1)) return -1;
+        RetaAntenas* reta = novaReta(r);
+        if (!reta) return -1;
+        reta->frequencia = frequencia;
+        reta->dx = e->dx;
+        reta->dy = e->dy;
+        reta->inicio = r->numAntenas;
+        reta->num = e->contagem + 1;
+        r->antenas[r->numAntenas] = *a;
+        e->destino = r->numAntenas + 1;
+        r->numAntenas += reta->num;
+    }
+    // Colocar as antenas de cada reta guardada (já estão pela ordem da direção)
+    for (int j = i + 1; j < num; j++) {
+        if (grupo[j].x == a->x && grupo[j].y == a->y) continue;
+        EntradaDirecao* e = &w->tabela[w->entrada[j]];
+        if (e->destino >= 0) r->antenas[e->destino++] = grupo[j];
+    }
+    return 0;
+}
+
+/**
+ * @brief Tarefa: processa até COLINEAR_ANTENAS_TAREFA antenas de referência de uma frequência.
+ */
+static void tarefaColinear(void* contexto, int tarefa, int trabalhador) {
+    ContextoColinear* ctx = (ContextoColinear*)contexto;
+    ResultadoTarefa* r = &ctx->resultados[tarefa];
+    TrabalhoColinear* w = &ctx->trabalho[trabalhador];
+    int f = ctx->tarefaFrequencia[tarefa];
+    const Coordenada* grupo = ctx->antenas + ctx->inicio[f];
+    int num = ctx->inicio[f + 1] - ctx->inicio[f];
+    int ini = ctx->tarefaInicio[tarefa];
+    int fim = ini + COLINEAR_ANTENAS_TAREFA < num ? ini + COLINEAR_ANTENAS_TAREFA : num;
+    r->efeitos = criarConjuntoEfeitos(0);
+    if (!r->efeitos) {
+        r->erro = 1;
+        return;
+    }
+    for (int i = ini; i < fim; i++) {
+        if (retasDaAntena(ctx, w, r, grupo, num, i, (char)f) < 0) {
+            r->erro = 1;
+            return;
+        }
+    }
+}
+#pragma endregion
+#pragma region Calcular Colineares
+/**
+ * @brief Agrupa as antenas de cada frequência pelas retas que as unem, em qualquer direção.
+ *
+ * Em vez de comparar todos os pares da lista, as antenas são separadas por frequência e
+ * cada antena de referência agrupa as restantes do seu grupo por direção normalizada numa
+ * tabela de dispersão (ver retasDaAntena): as antenas da mesma reta ficam juntas sem
+ * testar triplos de antenas. A memória de trabalho é proporcional ao maior grupo, não ao
+ * número de pares, e as antenas de referência são divididas em tarefas independentes
+ * executadas em paralelo (executarTarefas); os resultados são juntados pela ordem das
+ * tarefas, por isso não dependem do número de threads.
+ *
+ * O conjunto de efeitos tem os pontos médios inteiros de todos os pares, em qualquer
+ * direção (as mesmas posições que REGRA_COLINEAR em regras.h). Só as retas com pelo
+ * menos "minimo" antenas são guardadas: com minimo 2 cada par forma uma reta, o que
+ * para grupos grandes ocupa muita memória, por isso o normal é usar 3 ou mais.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param minimo Número mínimo de antenas das retas guardadas (valores menores que 2 contam como 2).
+ * @param numTrabalhadores Número de threads (0 ou negativo para usar todos os processadores).
+ * @return Resultado (libertar com libertarColineares), ou NULL em caso de erro.
+ */
+ResultadoColinear* calcularColineares(Vertice* lista, int minimo, int numTrabalhadores) {
+    int n = 0;
+    for (Vertice* v = lista; v; v = v->prox) n++;
+    ResultadoColinear* res = (ResultadoColinear*)calloc(1, sizeof(ResultadoColinear));
+    if (res) res->efeitos = criarConjuntoEfeitos(n);
+    if (!res || !res->efeitos) {
+        printf("Erro ao alocar memória para as retas!\n");
+        libertarColineares(res);
+        return NULL;
+    }
+    if (n < 2) return res;
+
+    ContextoColinear ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.minimo = minimo < 2 ? 2 : minimo;
+    ctx.antenas = (Coordenada*)malloc((size_t)n * sizeof(Coordenada));
+    if (!ctx.antenas) {
+        printf("Erro ao alocar memória para as retas!\n");
+        libertarColineares(res);
+        return NULL;
+    }
+    // Separar por frequência e ordenar cada grupo por (x, y)
+    for (Vertice* v = lista; v; v = v->prox) {
+        ctx.inicio[(unsigned char)v->frequencia + 1]++;
+    }
+    for (int f = 0; f < 256; f++) {
+        ctx.inicio[f + 1] += ctx.inicio[f];
+    }
+    int livre[256];
+    memcpy(livre, ctx.inicio, sizeof(livre));
+    for (Vertice* v = lista; v; v = v->prox) {
+        Coordenada* p = &ctx.antenas[livre[(unsigned char)v->frequencia]++];
+        p->x = v->x;
+        p->y = v->y;
+    }
+    int numTarefas = 0, maiorGrupo = 0;
+    for (int f = 0; f < 256; f++) {
+        int num = ctx.inicio[f + 1] - ctx.inicio[f];
+        if (num < 2) continue;
+        qsort(ctx.antenas + ctx.inicio[f], (size_t)num, sizeof(Coordenada), compararXY);
+        numTarefas += (num + COLINEAR_ANTENAS_TAREFA - 1) / COLINEAR_ANTENAS_TAREFA;
+        if (num > maiorGrupo) maiorGrupo = num;
+    }
+
+    int trabalhadores = numeroTrabalhadores(numTrabalhadores);
+    ctx.tarefaFrequencia = (int*)malloc((size_t)(numTarefas + 1) * sizeof(int));
+    ctx.tarefaInicio = (int*)malloc((size_t)(numTarefas + 1) * sizeof(int));
+    ctx.resultados = (ResultadoTarefa*)calloc((size_t)numTarefas + 1, sizeof(ResultadoTarefa));
+    ctx.trabalho = (TrabalhoColinear*)calloc((size_t)trabalhadores, sizeof(TrabalhoColinear));
+    int erro = !ctx.tarefaFrequencia || !ctx.tarefaInicio || !ctx.resultados || !ctx.trabalho;
+    unsigned int tamanhoTabela = 16;
+    while (tamanhoTabela < (unsigned int)maiorGrupo * 2) tamanhoTabela *= 2;
+    for (int t = 0; t < trabalhadores && !erro; t++) {
+        TrabalhoColinear* w = &ctx.trabalho[t];
+        w->tabela = (EntradaDirecao*)calloc(tamanhoTabela, sizeof(EntradaDirecao));
+        w->entrada = (int*)malloc((size_t)maiorGrupo * sizeof(int));
+        w->usadas = (int*)malloc((size_t)maiorGrupo * sizeof(int));
+        w->mascara = tamanhoTabela - 1;
+        w->marca = 0;
+        erro = !w->tabela || !w->entrada || !w->usadas;
+    }
+    if (!erro) {
+        int t = 0;
+        for (int f = 0; f < 256; f++) {
+            int num = ctx.inicio[f + 1] - ctx.inicio[f];
+            if (num < 2) continue;
+            for (int i = 0; i < num; i += COLINEAR_ANTENAS_TAREFA, t++) {
+                ctx.tarefaFrequencia[t] = f;
+                ctx.tarefaInicio[t] = i;
+            }
+        }
+        erro = executarTarefas(numTarefas, tarefaColinear, &ctx, trabalhadores) < 0;
+    }
+
+    // Juntar os resultados das tarefas pela ordem
+    for (int t = 0; t < numTarefas && !erro; t++) {
+        ResultadoTarefa* r = &ctx.resultados[t];
+        if (r->erro) {
+            erro = 1;
+            break;
+        }
+        res->numPares += r->numPares;
+        for (int k = 0; k < r->efeitos->total && !erro; k++) {
+            erro = adicionarEfeito(res->efeitos, r->efeitos->celulas[k].x, r->efeitos->celulas[k].y,
+                                   r->efeitos->direcao[k]) < 0;
+        }
+    }
+    int totalRetas = 0, totalAntenas = 0;
+    for (int t = 0; t < numTarefas && !erro; t++) {
+        totalRetas += ctx.resultados[t].numRetas;
+        totalAntenas += ctx.resultados[t].numAntenas;
+    }
+    if (!erro) {
+        res->retas = (RetaAntenas*)malloc((size_t)(totalRetas > 0 ? totalRetas : 1) * sizeof(RetaAntenas));
+        res->antenas = (Coordenada*)malloc((size_t)(totalAntenas > 0 ? totalAntenas : 1) * sizeof(Coordenada));
+        erro = !res->retas || !res->antenas;
+    }
+    for (int t = 0; t < numTarefas && !erro; t++) {
+        ResultadoTarefa* r = &ctx.resultados[t];
+        for (int k = 0; k < r->numRetas; k++) {
+            res->retas[res->numRetas] = r->retas[k];
+            res->retas[res->numRetas].inicio += res->numAntenas;
+            res->numRetas++;
+        }
+        if (r->numAntenas > 0) {
+            memcpy(res->antenas + res->numAntenas, r->antenas, (size_t)r->numAntenas * sizeof(Coordenada));
+        }
+        res->numAntenas += r->numAntenas;
+    }
+
+    for (int t = 0; ctx.resultados && t < numTarefas; t++) {
+        free(ctx.resultados[t].retas);
+        free(ctx.resultados[t].antenas);
+        libertarConjuntoEfeitos(ctx.resultados[t].efeitos);
+    }
+    for (int t = 0; ctx.trabalho && t < trabalhadores; t++) {
+        free(ctx.trabalho[t].tabela);
+        free(ctx.trabalho[t].entrada);
+        free(ctx.trabalho[t].usadas);
+    }
+    free(ctx.resultados);
+    free(ctx.trabalho);
+    free(ctx.tarefaFrequencia);
+    free(ctx.tarefaInicio);
+    free(ctx.antenas);
+    if (erro) {
+        printf("Erro ao alocar memória para as retas!\n");
+        libertarColineares(res);
+        return NULL;
+    }
+    return res;
+}
+
+/**
+ * @brief Liberta o resultado de calcularColineares.
+ *
+ * @param r Resultado.
+ * @return 0 em caso de sucesso.
+ */
+int libertarColineares(ResultadoColinear* r) {
+    if (!r) return 0;
+    free(r->retas);
+    free(r->antenas);
+    libertarConjuntoEfeitos(r->efeitos);
+    free(r);
+    return 0;
+}
+#pragma endregion
@@ -0,0 +1,56 @@
+/**
+ * @file colinear.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Antenas alinhadas em qualquer direção, agrupadas por reta com direções normalizadas
+ * @version 0.1
+ * @date 2025-06-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef COLINEAR_H
+#define COLINEAR_H
+
+#include "grafo.h"
+#include "efeitos.h"
+
+/**
+ * @brief Reta com antenas da mesma frequência.
+ */
+typedef struct retaAntenas {
+    char frequencia;
+    int dx, dy;                  // Direção normalizada (dx > 0, ou dx == 0 e dy > 0, sem divisor comum)
+    int inicio;                  // Posição da primeira antena da reta em ResultadoColinear.antenas
+    int num;                     // Número de antenas da reta
+} RetaAntenas;
+
+/**
+ * @brief Resultado de calcularColineares.
+ */
+typedef struct resultadoColinear {
+    int numRetas;
+    RetaAntenas* retas;          // Retas com pelo menos o número mínimo de antenas
+    int numAntenas;
+    Coordenada* antenas;         // Antenas de cada reta, seguidas e pela ordem da direção
+    long long numPares;          // Número de pares de antenas da mesma frequência
+    ConjuntoEfeitos* efeitos;    // Pontos médios inteiros de todos os pares (regra REGRA_COLINEAR)
+} ResultadoColinear;
+
+/**
+ * @brief Agrupa as antenas de cada frequência por reta e calcula os pontos médios dos pares
+ * @param lista Lista de antenas
+ * @param minimo Número mínimo de antenas das retas devolvidas (pelo menos 2)
+ * @param numTrabalhadores Número de threads (0 para usar todos os processadores)
+ * @return Resultado, ou NULL em caso de erro
+ */
+ResultadoColinear* calcularColineares(Vertice* lista, int minimo, int numTrabalhadores);
+
+/**
+ * @brief Liberta o resultado de calcularColineares
+ * @param r Resultado
+ * @return 0 em caso de sucesso
+ */
+int libertarColineares(ResultadoColinear* r);
+
+#endif
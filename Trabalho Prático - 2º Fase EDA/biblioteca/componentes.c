@@ -0,0 +1,303 @@
+/**
+ * @file componentes.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação das componentes ligadas com union-find
+ * @version 0.1
+ * @date 2025-06-02
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "componentes.h"
+#include "paralelo.h"
+
+/**
+ * @brief Dados partilhados pelas tarefas de união (uma por frequência).
+ */
+typedef struct contextoComponentes {
+    Vertice** vertices;          // Vértice com cada número
+    int n;
+    int* pai;                    // Union-find: pai de cada vértice (raiz = ele próprio)
+    unsigned char* rank;         // Union-find: limite da altura de cada árvore
+    Vertice** grupos;            // Vértices agrupados por frequência
+    int inicio[257];             // Início de cada frequência em grupos
+    char* cruza;                 // 1 se o vértice tem arestas para outras frequências
+} ContextoComponentes;
+
+#pragma region Union-Find
+/**
+ * @brief Procura a raiz da árvore de v, ligando à raiz os vértices do percurso (compressão de caminho).
+ */
+static int raiz(int* pai, int v) {
+    int r = v;
+    while (pai[r] != r) {
+        r = pai[r];
+    }
+    while (pai[v] != r) {
+        int seguinte = pai[v];
+        pai[v] = r;
+        v = seguinte;
+    }
+    return r;
+}
+
+/**
+ * @brief Junta as árvores de a e b, pendurando a mais baixa na mais alta (união por rank).
+ */
+static void unir(int* pai, unsigned char* rank, int a, int b) {
+    a = raiz(pai, a);
+    b = raiz(pai, b);
+    if (a == b) return;
+    if (rank[a] < rank[b]) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    pai[b] = a;
+    if (rank[a] == rank[b]) rank[a]++;
+}
+
+/**
+ * @brief Devolve o número de um vértice da lista, ou -1 se não pertencer à lista numerada.
+ */
+static int numeroNaLista(ContextoComponentes* ctx, Vertice* v) {
+    if (!v || v->id < 0 || v->id >= ctx->n || ctx->vertices[v->id] != v) return -1;
+    return v->id;
+}
+#pragma endregion
+#pragma region Unir por Frequência
+/**
+ * @brief Tarefa: junta os vértices de uma frequência ligados por arestas dentro da frequência.
+ *
+ * Cada tarefa só mexe nas posições de pai/rank dos vértices da sua frequência, por isso
+ * as frequências podem ser tratadas em paralelo sem trincos. As arestas entre frequências
+ * diferentes só são marcadas e ficam para o fim.
+ */
+static void unirFrequencia(void* contexto, int f, int trabalhador) {
+    (void)trabalhador;
+    ContextoComponentes* ctx = (ContextoComponentes*)contexto;
+    for (int i = ctx->inicio[f]; i < ctx->inicio[f + 1]; i++) {
+        Vertice* v = ctx->grupos[i];
+        for (AdjD* adj = v->adjacencias; adj; adj = adj->next) {
+            int w = numeroNaLista(ctx, adj->destino);
+            if (w < 0) continue;
+            if (adj->destino->frequencia == v->frequencia) {
+                unir(ctx->pai, ctx->rank, v->id, w);
+            } else {
+                ctx->cruza[v->id] = 1;
+            }
+        }
+    }
+}
+#pragma endregion
+#pragma region Numerar Componentes
+/**
+ * @brief Dá números seguidos às raízes (pela ordem da lista), guarda-os nos vértices e conta os tamanhos.
+ *
+ * @return 0 em caso de sucesso, 1 em caso de erro de memória.
+ */
+static int numerarComponentes(ComponentesGrafo* c, Vertice** vertices, int* pai, int* numero) {
+    int n = c->numVertices;
+    for (int i = 0; i < n; i++) numero[i] = -1;
+    for (int i = 0; i < n; i++) {
+        int r = raiz(pai, i);
+        if (numero[r] < 0) numero[r] = c->numComponentes++;
+        vertices[i]->componente = numero[r];
+    }
+    c->tamanho = (int*)calloc((size_t)c->numComponentes, sizeof(int));
+    if (!c->tamanho) return 1;
+    for (int i = 0; i < n; i++) c->tamanho[vertices[i]->componente]++;
+    for (int k = 0; k < c->numComponentes; k++) {
+        if (c->maior < 0 || c->tamanho[k] > c->tamanho[c->maior]) c->maior = k;
+    }
+    return 0;
+}
+#pragma endregion
+#pragma region Calcular Componentes
+/**
+ * @brief Calcula as componentes ligadas do grafo e guarda o número de cada uma nos vértices.
+ *
+ * As arestas são tratadas como não dirigidas (componentes fracamente ligadas). Nos grafos
+ * criados por CriarGrafo as ligações existem nos dois sentidos, por isso duas antenas
+ * estão na mesma componente exatamente quando uma é alcançável a partir da outra, e a
+ * pergunta passa a ser uma comparação (mesmaComponente) em vez de uma DFS.
+ *
+ * Usa union-find com compressão de caminho e união por rank. As arestas entre antenas
+ * da mesma frequência (todas, no caso de CriarGrafo) são tratadas em paralelo, uma
+ * frequência por tarefa; as restantes são juntadas no fim. Os números das componentes
+ * seguem a ordem da lista. Os vértices são numerados com numerarVertices.
+ * Depois de alterar o grafo é preciso voltar a calcular as componentes.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param numTrabalhadores Número de threads (0 ou negativo para usar todos os processadores).
+ * @return Resumo das componentes (libertar com libertarComponentes), ou NULL em caso de erro.
+ */
+ComponentesGrafo* calcularComponentes(Vertice* lista, int numTrabalhadores) {
+    ComponentesGrafo* c = (ComponentesGrafo*)calloc(1, sizeof(ComponentesGrafo));
+    if (!c) {
+        printf("Erro ao alocar memória para as componentes!\n");
+        return NULL;
+    }
+    c->maior = -1;
+    int n = numerarVertices(lista);
+    c->numVertices = n;
+    if (n == 0) return c;
+
+    ContextoComponentes ctx;
+    ctx.n = n;
+    ctx.vertices = (Vertice**)malloc((size_t)n * sizeof(Vertice*));
+    ctx.grupos = (Vertice**)malloc((size_t)n * sizeof(Vertice*));
+    ctx.pai = (int*)malloc((size_t)n * sizeof(int));
+    ctx.rank = (unsigned char*)calloc((size_t)n, 1);
+    ctx.cruza = (char*)calloc((size_t)n, 1);
+    int* numero = (int*)malloc((size_t)n * sizeof(int));   // Número da componente de cada raiz
+    if (!ctx.vertices || !ctx.grupos || !ctx.pai || !ctx.rank || !ctx.cruza || !numero) {
+        printf("Erro ao alocar memória para as componentes!\n");
+        free(ctx.vertices); free(ctx.grupos); free(ctx.pai); free(ctx.rank); free(ctx.cruza); free(numero);
+        free(c);
+        return NULL;
+    }
+    // Agrupar por frequência (ordenação por contagem)
+    for (int f = 0; f < 257; f++) ctx.inicio[f] = 0;
+    int i = 0;
+    for (Vertice* v = lista; v; v = v->prox, i++) {
+        ctx.vertices[i] = v;
+        ctx.pai[i] = i;
+        ctx.inicio[(unsigned char)v->frequencia + 1]++;
+    }
+    for (int f = 0; f < 256; f++) ctx.inicio[f + 1] += ctx.inicio[f];
+    int livre[256];
+    for (int f = 0; f < 256; f++) livre[f] = ctx.inicio[f];
+    for (i = 0; i < n; i++) {
+        ctx.grupos[livre[(unsigned char)ctx.vertices[i]->frequencia]++] = ctx.vertices[i];
+    }
+
+    int erro = executarTarefas(256, unirFrequencia, &ctx, numTrabalhadores) < 0;
+    // Arestas entre frequências diferentes
+    for (i = 0; i < n && !erro; i++) {
+        if (!ctx.cruza[i]) continue;
+        for (AdjD* adj = ctx.vertices[i]->adjacencias; adj; adj = adj->next) {
+            int w = numeroNaLista(&ctx, adj->destino);
+            if (w >= 0) unir(ctx.pai, ctx.rank, i, w);
+        }
+    }
+    if (!erro) erro = numerarComponentes(c, ctx.vertices, ctx.pai, numero);
+    free(ctx.vertices);
+    free(ctx.grupos);
+    free(ctx.pai);
+    free(ctx.rank);
+    free(ctx.cruza);
+    free(numero);
+    if (erro) {
+        printf("Erro ao alocar memória para as componentes!\n");
+        libertarComponentes(c);
+        return NULL;
+    }
+    return c;
+}
+
+/**
+ * @brief Calcula as componentes ligadas de um grafo implícito (ver implicito.h).
+ *
+ * Cada grupo de frequência é juntado numa só árvore com k - 1 uniões, sem olhar para as
+ * k(k-1) ligações que representa; depois juntam-se as ligações explícitas. O custo é
+ * O(N + ligações explícitas). Os resultados ficam como em calcularComponentes.
+ *
+ * @param g Grafo implícito.
+ * @return Resumo das componentes (libertar com libertarComponentes), ou NULL em caso de erro.
+ */
+ComponentesGrafo* calcularComponentesImplicito(GrafoImplicito* g) {
+    if (!g) return NULL;
+    ComponentesGrafo* c = (ComponentesGrafo*)calloc(1, sizeof(ComponentesGrafo));
+    if (!c) {
+        printf("Erro ao alocar memória para as componentes!\n");
+        return NULL;
+    }
+    c->maior = -1;
+    int n = numerarVertices(g->lista);
+    c->numVertices = n;
+    if (n == 0) return c;
+
+    ContextoComponentes ctx;
+    ctx.n = n;
+    ctx.vertices = (Vertice**)malloc((size_t)n * sizeof(Vertice*));
+    ctx.pai = (int*)malloc((size_t)n * sizeof(int));
+    ctx.rank = (unsigned char*)calloc((size_t)n, 1);
+    int* numero = (int*)malloc((size_t)n * sizeof(int));
+    int erro = !ctx.vertices || !ctx.pai || !ctx.rank || !numero;
+    if (!erro) {
+        int i = 0;
+        for (Vertice* v = g->lista; v; v = v->prox, i++) {
+            ctx.vertices[i] = v;
+            ctx.pai[i] = i;
+        }
+        for (int f = 0; f < 256; f++) {
+            for (int k = g->inicio[f] + 1; k < g->inicio[f + 1]; k++) {
+                unir(ctx.pai, ctx.rank, g->grupos[g->inicio[f]]->id, g->grupos[k]->id);
+            }
+        }
+        for (i = 0; i < n; i++) {
+            for (AdjD* adj = ctx.vertices[i]->adjacencias; adj; adj = adj->next) {
+                int w = numeroNaLista(&ctx, adj->destino);
+                if (w >= 0) unir(ctx.pai, ctx.rank, i, w);
+            }
+        }
+        erro = numerarComponentes(c, ctx.vertices, ctx.pai, numero);
+    }
+    free(ctx.vertices);
+    free(ctx.pai);
+    free(ctx.rank);
+    free(numero);
+    if (erro) {
+        printf("Erro ao alocar memória para as componentes!\n");
+        libertarComponentes(c);
+        return NULL;
+    }
+    return c;
+}
+#pragma endregion
+#pragma region Consultar Componentes
+/**
+ * @brief Verifica se duas antenas estão na mesma componente ligada.
+ *
+ * Só é válido depois de calcularComponentes e enquanto o grafo não for alterado.
+ *
+ * @param a Primeira antena.
+ * @param b Segunda antena.
+ * @return 1 se estão na mesma componente, 0 caso contrário.
+ */
+int mesmaComponente(Vertice* a, Vertice* b) {
+    return a && b && a->componente >= 0 && a->componente == b->componente;
+}
+
+/**
+ * @brief Imprime o número de componentes e o tamanho de cada uma.
+ *
+ * @param c Resumo das componentes.
+ * @return Número de componentes.
+ */
+int imprimirComponentes(ComponentesGrafo* c) {
+    if (!c) return 0;
+    printf("Componentes ligadas: %d (%d antenas)\n", c->numComponentes, c->numVertices);
+    for (int k = 0; k < c->numComponentes; k++) {
+        printf("Componente %d: %d antenas\n", k, c->tamanho[k]);
+    }
+    return c->numComponentes;
+}
+
+/**
+ * @brief Liberta a memória do resumo das componentes.
+ *
+ * @param c Resumo das componentes.
+ * @return 0 em caso de sucesso.
+ */
+int libertarComponentes(ComponentesGrafo* c) {
+    if (!c) return 0;
+    free(c->tamanho);
+    free(c);
+    return 0;
+}
+#pragma endregion
@@ -0,0 +1,68 @@
+/**
+ * @file componentes.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Componentes ligadas do grafo de antenas calculadas com union-find
+ * @version 0.1
+ * @date 2025-06-02
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef COMPONENTES_H
+#define COMPONENTES_H
+
+#include "grafo.h"
+#include "implicito.h"
+
+/**
+ * @brief Resumo das componentes ligadas de uma lista de antenas.
+ *
+ * Cada vértice fica com o número da sua componente no campo "componente"
+ * (0 a numComponentes - 1, pela ordem da lista).
+ */
+typedef struct componentesGrafo {
+    int numVertices;
+    int numComponentes;
+    int* tamanho;                // Número de vértices de cada componente
+    int maior;                   // Componente com mais vértices (-1 se não houver)
+} ComponentesGrafo;
+
+/**
+ * @brief Calcula as componentes ligadas e guarda o número de cada vértice
+ * @param lista Lista de antenas (com adjacências)
+ * @param numTrabalhadores Número de threads (0 para usar todos os processadores, 1 para não usar threads)
+ * @return Resumo das componentes, ou NULL em caso de erro
+ */
+ComponentesGrafo* calcularComponentes(Vertice* lista, int numTrabalhadores);
+
+/**
+ * @brief Calcula as componentes de um grafo implícito sem percorrer as ligações por frequência
+ * @param g Grafo implícito
+ * @return Resumo das componentes, ou NULL em caso de erro
+ */
+ComponentesGrafo* calcularComponentesImplicito(GrafoImplicito* g);
+
+/**
+ * @brief Verifica se duas antenas estão na mesma componente (depois de calcularComponentes)
+ * @param a Primeira antena
+ * @param b Segunda antena
+ * @return 1 se estão ligadas, 0 caso contrário
+ */
+int mesmaComponente(Vertice* a, Vertice* b);
+
+/**
+ * @brief Imprime o número de componentes e o tamanho de cada uma
+ * @param c Resumo das componentes
+ * @return Número de componentes
+ */
+int imprimirComponentes(ComponentesGrafo* c);
+
+/**
+ * @brief Liberta a memória do resumo (os números nos vértices mantêm-se)
+ * @param c Resumo das componentes
+ * @return 0 em caso de sucesso
+ */
+int libertarComponentes(ComponentesGrafo* c);
+
+#endif
@@ -0,0 +1,409 @@
+/**
+ * @file csr.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Construção e pesquisas sobre a representação CSR do grafo de antenas
+ * @version 0.1
+ * @date 2025-05-22
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "csr.h"
+#include "saida.h"
+
+#define BLOCO_SAIDA (64 * 1024)   // Bytes de caminhos formatados antes de escrever no ecrã
+
+#pragma region Construir CSR
+/**
+ * @brief Constrói a representação CSR a partir da lista de antenas e das suas adjacências.
+ *
+ * Numera os vértices pela ordem da lista (numerarVertices) e copia coordenadas,
+ * frequências e destinos das adjacências para vetores contínuos. Depois de construída,
+ * a representação não acompanha alterações feitas à lista.
+ *
+ * @param lista Apontador para o início da lista de vértices (antenas).
+ * @return Apontador para o grafo CSR, ou NULL em caso de erro de memória.
+ */
+GrafoCSR* construirCSR(Vertice* lista) {
+    GrafoCSR* g = (GrafoCSR*)calloc(1, sizeof(GrafoCSR));
+    if (!g) {
+        printf("Erro ao alocar memória para o grafo CSR!\n");
+        return NULL;
+    }
+    int n = numerarVertices(lista);
+    int m = 0;
+    for (Vertice* v = lista; v; v = v->prox) {
+        for (AdjD* adj = v->adjacencias; adj; adj = adj->next) {
+            m++;
+        }
+    }
+    g->numVertices = n;
+    g->numArestas = m;
+    // Reserva pelo menos uma posição para que malloc(0) não seja confundido com erro
+    g->x = (int*)malloc((n + 1) * sizeof(int));
+    g->y = (int*)malloc((n + 1) * sizeof(int));
+    g->frequencia = (char*)malloc(n + 1);
+    g->inicio = (int*)malloc((n + 1) * sizeof(int));
+    g->vizinhos = (int*)malloc((m + 1) * sizeof(int));
+    g->vertices = (Vertice**)malloc((n + 1) * sizeof(Vertice*));
+    g->marca = (unsigned int*)calloc(n + 1, sizeof(unsigned int));
+    g->pilha = (int*)malloc((n + 1) * sizeof(int));
+    g->posicao = (int*)malloc((n + 1) * sizeof(int));
+    if (!g->x || !g->y || !g->frequencia || !g->inicio || !g->vizinhos ||
+        !g->vertices || !g->marca || !g->pilha || !g->posicao) {
+        printf("Erro ao alocar memória para o grafo CSR!\n");
+        libertarCSR(g);
+        return NULL;
+    }
+    int i = 0, k = 0;
+    for (Vertice* v = lista; v; v = v->prox, i++) {
+        g->x[i] = v->x;
+        g->y[i] = v->y;
+        g->frequencia[i] = v->frequencia;
+        g->vertices[i] = v;
+        g->inicio[i] = k;
+        for (AdjD* adj = v->adjacencias; adj; adj = adj->next) {
+            g->vizinhos[k++] = adj->destino->id;
+        }
+    }
+    g->inicio[n] = k;
+    g->epoca = 0;
+    return g;
+}
+#pragma endregion
+#pragma region Libertar CSR
+/**
+ * @brief Liberta toda a memória do grafo CSR.
+ *
+ * @param g Grafo CSR a libertar.
+ * @return 0 em caso de sucesso.
+ */
+int libertarCSR(GrafoCSR* g) {
+    if (!g) return 0;
+    free(g->x);
+    free(g->y);
+    free(g->frequencia);
+    free(g->inicio);
+    free(g->vizinhos);
+    free(g->vertices);
+    free(g->marca);
+    free(g->pilha);
+    free(g->posicao);
+    free(g);
+    return 0;
+}
+#pragma endregion
+#pragma region Nova Época
+/**
+ * @brief Começa uma nova pesquisa sem ter de limpar as marcas de todos os vértices.
+ *
+ * Um vértice está visitado quando a sua marca é igual à época atual. Só quando
+ * o contador dá a volta é que as marcas são postas a zero.
+ *
+ * @param g Grafo CSR.
+ * @return Época da nova pesquisa.
+ */
+static unsigned int novaEpoca(GrafoCSR* g) {
+    g->epoca++;
+    if (g->epoca == 0) {
+        memset(g->marca, 0, g->numVertices * sizeof(unsigned int));
+        g->epoca = 1;
+    }
+    return g->epoca;
+}
+#pragma endregion
+#pragma region Procurar
+/**
+ * @brief Procura o primeiro vértice com as coordenadas (x, y) por pesquisa binária.
+ *
+ * Os vértices estão pela ordem da lista, que está ordenada por (x, y).
+ *
+ * @param g Grafo CSR.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Número do vértice, ou -1 se não existir.
+ */
+int procurarCSR(GrafoCSR* g, int x, int y) {
+    if (!g) return -1;
+    int esq = 0, dir = g->numVertices;
+    while (esq < dir) {
+        int meio = esq + (dir - esq) / 2;
+        if (g->x[meio] < x || (g->x[meio] == x && g->y[meio] < y)) {
+            esq = meio + 1;
+        } else {
+            dir = meio;
+        }
+    }
+    if (esq < g->numVertices && g->x[esq] == x && g->y[esq] == y) {
+        return esq;
+    }
+    return -1;
+}
+#pragma endregion
+#pragma region Profundidade
+/**
+ * @brief Pesquisa em profundidade (DFS) sobre o grafo CSR.
+ *
+ * Usa uma pilha explícita com a posição do próximo vizinho de cada vértice, por isso
+ * visita os vértices pela mesma ordem que a função dfs recursiva, sem risco de esgotar
+ * a pilha do programa.
+ *
+ * @param g Grafo CSR.
+ * @param origem Vértice inicial.
+ * @param ordem Vetor onde fica a ordem de visita (pode ser NULL).
+ * @return Número de vértices visitados.
+ */
+int dfsCSR(GrafoCSR* g, int origem, int* ordem) {
+    if (!g || origem < 0 || origem >= g->numVertices) return 0;
+    unsigned int epoca = novaEpoca(g);
+    int topo = 0, total = 0;
+    g->marca[origem] = epoca;
+    if (ordem) ordem[total] = origem;
+    total++;
+    g->pilha[0] = origem;
+    g->posicao[0] = g->inicio[origem];
+    while (topo >= 0) {
+        int v = g->pilha[topo];
+        if (g->posicao[topo] == g->inicio[v + 1]) {
+            topo--;  // Todos os vizinhos já foram vistos
+            continue;
+        }
+        int u = g->vizinhos[g->posicao[topo]++];
+        if (g->marca[u] != epoca) {
+            g->marca[u] = epoca;
+            if (ordem) ordem[total] = u;
+            total++;
+            topo++;
+            g->pilha[topo] = u;
+            g->posicao[topo] = g->inicio[u];
+        }
+    }
+    return total;
+}
+#pragma endregion
+#pragma region Largura
+/**
+ * @brief Pesquisa em largura (BFS) sobre o grafo CSR.
+ *
+ * @param g Grafo CSR.
+ * @param origem Vértice inicial.
+ * @param ordem Vetor onde fica a ordem de visita (pode ser NULL).
+ * @param distancia Vetor com o número de ligações desde a origem (-1 se inalcançável; pode ser NULL).
+ * @return Número de vértices visitados.
+ */
+int bfsCSR(GrafoCSR* g, int origem, int* ordem, int* distancia) {
+    if (!g || origem < 0 || origem >= g->numVertices) return 0;
+    unsigned int epoca = novaEpoca(g);
+    int* fila = g->pilha;
+    int frente = 0, fim = 0;
+    if (distancia) {
+        for (int i = 0; i < g->numVertices; i++) distancia[i] = -1;
+        distancia[origem] = 0;
+    }
+    g->marca[origem] = epoca;
+    fila[fim++] = origem;
+    while (frente < fim) {
+        int v = fila[frente++];
+        if (ordem) ordem[frente - 1] = v;
+        for (int k = g->inicio[v]; k < g->inicio[v + 1]; k++) {
+            int u = g->vizinhos[k];
+            if (g->marca[u] != epoca) {
+                g->marca[u] = epoca;
+                if (distancia) distancia[u] = distancia[v] + 1;
+                fila[fim++] = u;
+            }
+        }
+    }
+    return fim;
+}
+#pragma endregion
+#pragma region Caminho Mais Curto
+/**
+ * @brief Encontra o caminho com menos ligações entre dois vértices (BFS).
+ *
+ * @param g Grafo CSR.
+ * @param origem Vértice de partida.
+ * @param destino Vértice de chegada.
+ * @param caminho Vetor com espaço para numVertices posições onde fica o caminho.
+ * @return Número de vértices do caminho (incluindo origem e destino), ou 0 se não existir.
+ */
+int caminhoCSR(GrafoCSR* g, int origem, int destino, int* caminho) {
+    if (!g || !caminho || origem < 0 || destino < 0 ||
+        origem >= g->numVertices || destino >= g->numVertices) return 0;
+    unsigned int epoca = novaEpoca(g);
+    int* fila = g->pilha;
+    int* pai = g->posicao;
+    int frente = 0, fim = 0;
+    g->marca[origem] = epoca;
+    pai[origem] = -1;
+    fila[fim++] = origem;
+    while (frente < fim && g->marca[destino] != epoca) {
+        int v = fila[frente++];
+        for (int k = g->inicio[v]; k < g->inicio[v + 1]; k++) {
+            int u = g->vizinhos[k];
+            if (g->marca[u] != epoca) {
+                g->marca[u] = epoca;
+                pai[u] = v;
+                fila[fim++] = u;
+            }
+        }
+    }
+    if (g->marca[destino] != epoca) return 0;
+    int tamanho = 0;
+    for (int v = destino; v != -1; v = pai[v]) {
+        tamanho++;
+    }
+    int i = tamanho;
+    for (int v = destino; v != -1; v = pai[v]) {
+        caminho[--i] = v;
+    }
+    return tamanho;
+}
+#pragma endregion
+#pragma region Encontrar Caminhos
+/**
+ * @brief Acrescenta um caminho (os vértices da pilha) ao resultado.
+ *
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int guardarCaminhoCSR(CaminhosCSR* r, const int* pilha, int tamanho) {
+    if (r->numCaminhos + 1 >= r->capacidadeCaminhos) {
+        int capacidade = r->capacidadeCaminhos ? r->capacidadeCaminhos * 2 : 16;
+        int* inicio = (int*)realloc(r->inicio, (size_t)capacidade * sizeof(int));
+        if (!inicio) return 0;
+        r->inicio = inicio;
+        r->capacidadeCaminhos = capacidade;
+    }
+    int usados = r->numCaminhos > 0 ? r->inicio[r->numCaminhos] : 0;
+    if (usados + tamanho > r->capacidadeVertices) {
+        int capacidade = r->capacidadeVertices ? r->capacidadeVertices : 64;
+        while (capacidade < usados + tamanho) capacidade *= 2;
+        int* vertices = (int*)realloc(r->vertices, (size_t)capacidade * sizeof(int));
+        if (!vertices) return 0;
+        r->vertices = vertices;
+        r->capacidadeVertices = capacidade;
+    }
+    if (r->numCaminhos == 0) r->inicio[0] = 0;
+    memcpy(r->vertices + usados, pilha, (size_t)tamanho * sizeof(int));
+    r->numCaminhos++;
+    r->inicio[r->numCaminhos] = usados + tamanho;
+    return 1;
+}
+
+/**
+ * @brief Percorre os caminhos simples entre dois vértices, sem recursividade.
+ *
+ * Faz o mesmo que encontrarCaminhos: a pilha guarda o caminho atual e a marca de cada
+ * vértice indica se ele já está no caminho. Cada caminho é guardado em r e/ou
+ * formatado em t (o texto é escrito no ecrã sempre que passa de BLOCO_SAIDA bytes).
+ *
+ * @param g Grafo CSR.
+ * @param origem Vértice de partida.
+ * @param destino Vértice de chegada.
+ * @param maxCaminhos Parar depois deste número de caminhos (0 = sem limite).
+ * @param r Onde guardar os caminhos (pode ser NULL).
+ * @param t Texto onde formatar os caminhos (pode ser NULL).
+ * @return Número de caminhos encontrados, ou -1 em caso de erro de memória.
+ */
+static int percorrerCaminhosCSR(GrafoCSR* g, int origem, int destino, int maxCaminhos,
+                                CaminhosCSR* r, TextoSaida* t) {
+    unsigned int epoca = novaEpoca(g);
+    int total = 0, topo = 0;
+    g->pilha[0] = origem;
+    g->posicao[0] = g->inicio[origem];
+    g->marca[origem] = epoca;
+    while (topo >= 0) {
+        int v = g->pilha[topo];
+        if (v == destino) {
+            if (r && !guardarCaminhoCSR(r, g->pilha, topo + 1)) return -1;
+            if (t) {
+                if (formatarCaminhoCSR(t, g, g->pilha, topo + 1) < 0) return -1;
+                if (t->tamanho >= BLOCO_SAIDA) escreverTexto(t, stdout);
+            }
+            total++;
+            if (maxCaminhos > 0 && total >= maxCaminhos) break;
+        }
+        if (v == destino || g->posicao[topo] == g->inicio[v + 1]) {
+            g->marca[v] = 0;  // Sai do caminho atual
+            topo--;
+            continue;
+        }
+        int u = g->vizinhos[g->posicao[topo]++];
+        if (g->marca[u] != epoca) {
+            g->marca[u] = epoca;
+            topo++;
+            g->pilha[topo] = u;
+            g->posicao[topo] = g->inicio[u];
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Encontra e imprime todos os caminhos simples entre dois vértices.
+ *
+ * Os caminhos são formatados num texto em memória e escritos em blocos, em vez de
+ * um printf por vértice.
+ *
+ * @param g Grafo CSR.
+ * @param origem Vértice de partida.
+ * @param destino Vértice de chegada.
+ * @return Número de caminhos encontrados, ou -1 em caso de erro de memória.
+ */
+int encontrarCaminhosCSR(GrafoCSR* g, int origem, int destino) {
+    if (!g || origem < 0 || destino < 0 ||
+        origem >= g->numVertices || destino >= g->numVertices) return 0;
+    TextoSaida texto = { 0 };
+    int total = percorrerCaminhosCSR(g, origem, destino, 0, NULL, &texto);
+    escreverTexto(&texto, stdout);
+    libertarTexto(&texto);
+    if (total < 0) printf("Erro ao alocar memória para os caminhos!\n");
+    return total;
+}
+
+/**
+ * @brief Encontra os caminhos simples entre dois vértices e guarda-os, sem imprimir.
+ *
+ * Os caminhos ficam pela mesma ordem de encontrarCaminhosCSR; para os mostrar usar
+ * formatarCaminhoCSR com cada caminho.
+ *
+ * @param g Grafo CSR.
+ * @param origem Vértice de partida.
+ * @param destino Vértice de chegada.
+ * @param maxCaminhos Parar depois deste número de caminhos (0 = sem limite).
+ * @return Caminhos encontrados (numCaminhos = 0 se não houver), ou NULL em caso de erro de memória.
+ */
+CaminhosCSR* procurarCaminhosCSR(GrafoCSR* g, int origem, int destino, int maxCaminhos) {
+    CaminhosCSR* r = (CaminhosCSR*)calloc(1, sizeof(CaminhosCSR));
+    if (!r) {
+        printf("Erro ao alocar memória para os caminhos!\n");
+        return NULL;
+    }
+    if (!g || origem < 0 || destino < 0 ||
+        origem >= g->numVertices || destino >= g->numVertices) return r;
+    if (percorrerCaminhosCSR(g, origem, destino, maxCaminhos, r, NULL) < 0) {
+        printf("Erro ao alocar memória para os caminhos!\n");
+        libertarCaminhosCSR(r);
+        return NULL;
+    }
+    return r;
+}
+
+/**
+ * @brief Liberta a memória dos caminhos.
+ *
+ * @param c Caminhos.
+ * @return 0 em caso de sucesso.
+ */
+int libertarCaminhosCSR(CaminhosCSR* c) {
+    if (!c) return 0;
+    free(c->inicio);
+    free(c->vertices);
+    free(c);
+    return 0;
+}
+#pragma endregion
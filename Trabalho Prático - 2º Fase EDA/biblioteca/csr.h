@@ -0,0 +1,131 @@
+/**
+ * @file csr.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Representação compacta (CSR) só de leitura do grafo de antenas
+ * @version 0.1
+ * @date 2025-05-22
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef CSR_H
+#define CSR_H
+
+#include "grafo.h"
+
+/**
+ * @brief Grafo em formato CSR (Compressed Sparse Row).
+ *
+ * Os vértices são identificados pela sua posição na lista (0 a numVertices - 1) e os
+ * dados de cada campo estão num vetor próprio. Os vizinhos do vértice v estão em
+ * vizinhos[inicio[v]] até vizinhos[inicio[v + 1] - 1], pela mesma ordem da lista de adjacências.
+ */
+typedef struct grafoCSR {
+    int numVertices;
+    int numArestas;
+    int* x;                      // Coordenada X de cada vértice
+    int* y;                      // Coordenada Y de cada vértice
+    char* frequencia;            // Frequência de cada vértice
+    int* inicio;                 // Posição do primeiro vizinho de cada vértice (numVertices + 1)
+    int* vizinhos;               // Vizinhos de todos os vértices seguidos
+    Vertice** vertices;          // Vértice da lista correspondente a cada posição
+    unsigned int* marca;         // Marca de visita de cada vértice (igual a epoca = visitado)
+    unsigned int epoca;          // Número da pesquisa atual
+    int* pilha;                  // Memória de trabalho das pesquisas
+    int* posicao;
+} GrafoCSR;
+
+/**
+ * @brief Constrói a representação CSR de uma lista de antenas
+ * @param lista Lista de antenas (com adjacências)
+ * @return Apontador para o grafo CSR, ou NULL em caso de erro
+ */
+GrafoCSR* construirCSR(Vertice* lista);
+
+/**
+ * @brief Liberta a memória do grafo CSR (a lista original não é alterada)
+ * @param g Grafo CSR
+ * @return 0 em caso de sucesso
+ */
+int libertarCSR(GrafoCSR* g);
+
+/**
+ * @brief Procura o primeiro vértice com as coordenadas indicadas
+ * @param g Grafo CSR
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Número do vértice, ou -1 se não existir
+ */
+int procurarCSR(GrafoCSR* g, int x, int y);
+
+/**
+ * @brief Pesquisa em profundidade a partir de um vértice
+ * @param g Grafo CSR
+ * @param origem Vértice inicial
+ * @param ordem Vetor onde fica a ordem de visita (pode ser NULL)
+ * @return Número de vértices visitados
+ */
+int dfsCSR(GrafoCSR* g, int origem, int* ordem);
+
+/**
+ * @brief Pesquisa em largura a partir de um vértice
+ * @param g Grafo CSR
+ * @param origem Vértice inicial
+ * @param ordem Vetor onde fica a ordem de visita (pode ser NULL)
+ * @param distancia Vetor com o número de ligações até cada vértice (-1 se inalcançável; pode ser NULL)
+ * @return Número de vértices visitados
+ */
+int bfsCSR(GrafoCSR* g, int origem, int* ordem, int* distancia);
+
+/**
+ * @brief Caminho com menos ligações entre dois vértices
+ * @param g Grafo CSR
+ * @param origem Vértice de partida
+ * @param destino Vértice de chegada
+ * @param caminho Vetor com espaço para numVertices posições
+ * @return Número de vértices do caminho, ou 0 se não existir
+ */
+int caminhoCSR(GrafoCSR* g, int origem, int destino, int* caminho);
+
+/**
+ * @brief Caminhos simples guardados por procurarCaminhosCSR.
+ *
+ * O caminho i ocupa vertices[inicio[i]] até vertices[inicio[i + 1] - 1], pela mesma
+ * ordem em que encontrarCaminhosCSR os imprime.
+ */
+typedef struct caminhosCSR {
+    int numCaminhos;             // Caminhos guardados
+    int* inicio;                 // Início de cada caminho (numCaminhos + 1)
+    int* vertices;               // Números dos vértices dos caminhos, seguidos
+    int capacidadeCaminhos;
+    int capacidadeVertices;
+} CaminhosCSR;
+
+/**
+ * @brief Encontra e imprime todos os caminhos simples entre dois vértices
+ * @param g Grafo CSR
+ * @param origem Vértice de partida
+ * @param destino Vértice de chegada
+ * @return Número de caminhos encontrados, ou -1 em caso de erro de memória
+ */
+int encontrarCaminhosCSR(GrafoCSR* g, int origem, int destino);
+
+/**
+ * @brief Encontra os caminhos simples entre dois vértices e guarda-os (sem imprimir)
+ * @param g Grafo CSR
+ * @param origem Vértice de partida
+ * @param destino Vértice de chegada
+ * @param maxCaminhos Parar depois deste número de caminhos (0 = sem limite)
+ * @return Caminhos encontrados, ou NULL em caso de erro de memória
+ */
+CaminhosCSR* procurarCaminhosCSR(GrafoCSR* g, int origem, int destino, int maxCaminhos);
+
+/**
+ * @brief Liberta a memória dos caminhos
+ * @param c Caminhos
+ * @return 0 em caso de sucesso
+ */
+int libertarCaminhosCSR(CaminhosCSR* c);
+
+#endif
@@ -0,0 +1,759 @@
+/**
+ * @file efeitos.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação do cálculo dos efeitos nefastos sem comparar todos os pares de antenas
+ * @version 0.1
+ * @date 2025-05-24
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "efeitos.h"
+#include "indice.h"
+#include "paralelo.h"
+
+#define EFEITOS_CAPACIDADE_MINIMA 64
+#define EFEITOS_MINIMO_PARALELO 4096   // Abaixo deste número de antenas não compensa usar threads
+
+/**
+ * @brief Cópia das coordenadas de uma antena usada na ordenação por grupos.
+ */
+typedef struct antenaOrdenada {
+    int x, y;
+    char frequencia;
+    int ordem;                   // Posição da antena na lista
+} AntenaOrdenada;
+
+#pragma region Conjunto de Efeitos
+/**
+ * @brief Cria um conjunto de efeitos vazio.
+ *
+ * @param capacidade Número de posições previsto (0 para o valor por omissão).
+ * @return Apontador para o conjunto, ou NULL em caso de erro de memória.
+ */
+ConjuntoEfeitos* criarConjuntoEfeitos(int capacidade) {
+    ConjuntoEfeitos* c = (ConjuntoEfeitos*)malloc(sizeof(ConjuntoEfeitos));
+    if (!c) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        return NULL;
+    }
+    if (capacidade < EFEITOS_CAPACIDADE_MINIMA) capacidade = EFEITOS_CAPACIDADE_MINIMA;
+    int tamanho = EFEITOS_CAPACIDADE_MINIMA * 2;
+    while (tamanho < capacidade * 2) {
+        tamanho *= 2;
+    }
+    c->celulas = (Coordenada*)malloc(capacidade * sizeof(Coordenada));
+    c->direcao = (char*)malloc(capacidade);
+    c->tabela = (int*)calloc(tamanho, sizeof(int));
+    if (!c->celulas || !c->direcao || !c->tabela) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    c->total = 0;
+    c->capacidade = capacidade;
+    c->tamanhoTabela = tamanho;
+    return c;
+}
+
+/**
+ * @brief Duplica o tamanho da tabela de dispersão e volta a distribuir as posições.
+ *
+ * @param c Conjunto de efeitos.
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int aumentarTabela(ConjuntoEfeitos* c) {
+    int tamanho = c->tamanhoTabela * 2;
+    int* tabela = (int*)calloc(tamanho, sizeof(int));
+    if (!tabela) return 0;
+    unsigned int mascara = (unsigned int)tamanho - 1;
+    for (int i = 0; i < c->total; i++) {
+        unsigned int p = dispersaoPosicao(c->celulas[i].x, c->celulas[i].y) & mascara;
+        while (tabela[p]) {
+            p = (p + 1) & mascara;
+        }
+        tabela[p] = i + 1;
+    }
+    free(c->tabela);
+    c->tabela = tabela;
+    c->tamanhoTabela = tamanho;
+    return 1;
+}
+
+/**
+ * @brief Acrescenta a posição (x, y) ao conjunto se ainda não existir.
+ *
+ * @param c Conjunto de efeitos.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param direcao Alinhamento das antenas que originaram o efeito.
+ * @return 1 se foi acrescentada, 0 se já existia, -1 em caso de erro de memória.
+ */
+int adicionarEfeito(ConjuntoEfeitos* c, int x, int y, char direcao) {
+    if (!c) return -1;
+    unsigned int mascara = (unsigned int)c->tamanhoTabela - 1;
+    unsigned int p = dispersaoPosicao(x, y) & mascara;
+    while (c->tabela[p]) {
+        Coordenada* e = &c->celulas[c->tabela[p] - 1];
+        if (e->x == x && e->y == y) return 0;
+        p = (p + 1) & mascara;
+    }
+    if (c->total == c->capacidade) {
+        int capacidade = c->capacidade * 2;
+        Coordenada* celulas = (Coordenada*)realloc(c->celulas, capacidade * sizeof(Coordenada));
+        if (!celulas) return -1;
+        c->celulas = celulas;
+        char* direcao2 = (char*)realloc(c->direcao, capacidade);
+        if (!direcao2) return -1;
+        c->direcao = direcao2;
+        c->capacidade = capacidade;
+    }
+    c->celulas[c->total].x = x;
+    c->celulas[c->total].y = y;
+    c->direcao[c->total] = direcao;
+    c->total++;
+    c->tabela[p] = c->total;
+    // Mantém a ocupação da tabela abaixo de 50%
+    if (c->total * 2 > c->tamanhoTabela && !aumentarTabela(c)) return -1;
+    return 1;
+}
+
+/**
+ * @brief Verifica se a posição (x, y) pertence ao conjunto.
+ *
+ * @param c Conjunto de efeitos.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return 1 se existir, 0 caso contrário.
+ */
+int contemEfeito(ConjuntoEfeitos* c, int x, int y) {
+    if (!c) return 0;
+    unsigned int mascara = (unsigned int)c->tamanhoTabela - 1;
+    unsigned int p = dispersaoPosicao(x, y) & mascara;
+    while (c->tabela[p]) {
+        Coordenada* e = &c->celulas[c->tabela[p] - 1];
+        if (e->x == x && e->y == y) return 1;
+        p = (p + 1) & mascara;
+    }
+    return 0;
+}
+
+/**
+ * @brief Muda o alinhamento de uma posição que já pertence ao conjunto.
+ *
+ * @param c Conjunto de efeitos.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param direcao Novo alinhamento.
+ * @return 1 se a posição existir, 0 caso contrário.
+ */
+int alterarDirecaoEfeito(ConjuntoEfeitos* c, int x, int y, char direcao) {
+    if (!c) return 0;
+    unsigned int mascara = (unsigned int)c->tamanhoTabela - 1;
+    unsigned int p = dispersaoPosicao(x, y) & mascara;
+    while (c->tabela[p]) {
+        int i = c->tabela[p] - 1;
+        if (c->celulas[i].x == x && c->celulas[i].y == y) {
+            c->direcao[i] = direcao;
+            return 1;
+        }
+        p = (p + 1) & mascara;
+    }
+    return 0;
+}
+
+/**
+ * @brief Liberta a memória do conjunto de efeitos.
+ *
+ * @param c Conjunto de efeitos.
+ * @return 0 em caso de sucesso.
+ */
+int libertarConjuntoEfeitos(ConjuntoEfeitos* c) {
+    if (!c) return 0;
+    free(c->celulas);
+    free(c->direcao);
+    free(c->tabela);
+    free(c);
+    return 0;
+}
+#pragma endregion
+#pragma region Ordenação por Grupos
+/**
+ * @brief Compara antenas por frequência, X, Y e posição na lista (grupos da mesma linha).
+ */
+static int compararPorX(const void* a, const void* b) {
+    const AntenaOrdenada* p = (const AntenaOrdenada*)a;
+    const AntenaOrdenada* q = (const AntenaOrdenada*)b;
+    if (p->frequencia != q->frequencia) return (unsigned char)p->frequencia < (unsigned char)q->frequencia ? -1 : 1;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    if (p->y != q->y) return p->y < q->y ? -1 : 1;
+    return (p->ordem > q->ordem) - (p->ordem < q->ordem);
+}
+
+/**
+ * @brief Compara antenas por frequência, Y, X e posição na lista (grupos da mesma coluna).
+ */
+static int compararPorY(const void* a, const void* b) {
+    const AntenaOrdenada* p = (const AntenaOrdenada*)a;
+    const AntenaOrdenada* q = (const AntenaOrdenada*)b;
+    if (p->frequencia != q->frequencia) return (unsigned char)p->frequencia < (unsigned char)q->frequencia ? -1 : 1;
+    if (p->y != q->y) return p->y < q->y ? -1 : 1;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    return (p->ordem > q->ordem) - (p->ordem < q->ordem);
+}
+#pragma endregion
+#pragma region Efeitos de uma Antena
+/**
+ * @brief Acrescenta ao conjunto os efeitos provocados pela antena número i da lista.
+ *
+ * @param porX Antenas ordenadas por (frequência, x, y).
+ * @param porY Antenas ordenadas por (frequência, y, x).
+ * @param posX Posição de cada antena em porX.
+ * @param posY Posição de cada antena em porY.
+ * @param n Número de antenas.
+ * @param i Posição da antena na lista.
+ * @param tipo Regra a aplicar.
+ * @param c Conjunto onde são guardados os efeitos.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int efeitosDaAntena(const AntenaOrdenada* porX, const AntenaOrdenada* porY, const int* posX,
+                           const int* posY, int n, int i, TipoEfeito tipo, ConjuntoEfeitos* c) {
+    int erro = 0;
+    const AntenaOrdenada* a = &porX[posX[i]];
+    if (tipo == EFEITO_DISTANCIA_2) {
+        // Mesmo X: procurar a antena em y + 2 nas seguintes do grupo
+        for (int k = posX[i] + 1; k < n && porX[k].frequencia == a->frequencia &&
+             porX[k].x == a->x && porX[k].y <= a->y + 2; k++) {
+            if (porX[k].y == a->y + 2) {
+                erro = adicionarEfeito(c, a->x, a->y + 1, DIRECAO_MESMO_X) < 0;
+                break;
+            }
+        }
+        // Mesmo Y: procurar a antena em x + 2 nas seguintes do grupo
+        for (int k = posY[i] + 1; k < n && !erro && porY[k].frequencia == a->frequencia &&
+             porY[k].y == a->y && porY[k].x <= a->x + 2; k++) {
+            if (porY[k].x == a->x + 2) {
+                erro = adicionarEfeito(c, a->x + 1, a->y, DIRECAO_MESMO_Y) < 0;
+                break;
+            }
+        }
+    } else {
+        // Limites dos grupos da antena (mesmo Y em porY, mesmo X em porX)
+        int iniY = posY[i], fimY = posY[i];
+        while (iniY > 0 && porY[iniY - 1].frequencia == a->frequencia && porY[iniY - 1].y == a->y) iniY--;
+        while (fimY + 1 < n && porY[fimY + 1].frequencia == a->frequencia && porY[fimY + 1].y == a->y) fimY++;
+        int iniX = posX[i], fimX = posX[i];
+        while (iniX > 0 && porX[iniX - 1].frequencia == a->frequencia && porX[iniX - 1].x == a->x) iniX--;
+        while (fimX + 1 < n && porX[fimX + 1].frequencia == a->frequencia && porX[fimX + 1].x == a->x) fimX++;
+        // Percorre o grupo pela ordem da lista: mesmo Y antes, mesmo X, mesmo Y depois
+        for (int k = iniY; k <= fimY && !erro && porY[k].x < a->x; k++) {
+            int dx = porY[k].x - a->x;
+            if (dx % 2 == 0) erro = adicionarEfeito(c, a->x + dx / 2, a->y, DIRECAO_MESMO_Y) < 0;
+        }
+        for (int k = iniX; k <= fimX && !erro; k++) {
+            if (porX[k].ordem == i) continue;
+            int dy = porX[k].y - a->y;
+            if (dy % 2 == 0) erro = adicionarEfeito(c, a->x, a->y + dy / 2, DIRECAO_MESMO_X) < 0;
+        }
+        for (int k = iniY; k <= fimY && !erro; k++) {
+            if (porY[k].x <= a->x) continue;
+            int dx = porY[k].x - a->x;
+            if (dx % 2 == 0) erro = adicionarEfeito(c, a->x + dx / 2, a->y, DIRECAO_MESMO_Y) < 0;
+        }
+    }
+    return erro ? -1 : 0;
+}
+#pragma endregion
+#pragma region Calcular Efeitos
+/**
+ * @brief Calcula as posições com efeito nefasto sem comparar todos os pares de antenas.
+ *
+ * As antenas são ordenadas duas vezes: por (frequência, x, y), o que junta as antenas da
+ * mesma frequência com o mesmo X, e por (frequência, y, x), o que junta as que têm o mesmo Y.
+ * Só as antenas do mesmo grupo podem estar alinhadas, por isso cada antena só é comparada
+ * com o seu grupo e as repetições são eliminadas pela tabela de dispersão do conjunto.
+ *
+ * - EFEITO_DISTANCIA_2: basta ver as antenas seguintes do grupo até 2 posições à frente,
+ *   o que dá um custo O(N log N). As posições ficam pela mesma ordem que em
+ *   calcularEfeitosNefastos.
+ * - EFEITO_DISTANCIA_PAR: cada antena é comparada com todo o seu grupo, pela ordem da lista,
+ *   por isso o custo é a soma dos quadrados dos tamanhos dos grupos (em vez de N²).
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param tipo Regra a aplicar.
+ * @return Conjunto com as posições afetadas (vazio se não houver), ou NULL em caso de erro.
+ */
+ConjuntoEfeitos* calcularEfeitos(Vertice* lista, TipoEfeito tipo) {
+    int n = 0;
+    for (Vertice* v = lista; v; v = v->prox) n++;
+    ConjuntoEfeitos* c = criarConjuntoEfeitos(n);
+    if (!c || n == 0) return c;
+
+    AntenaOrdenada* porX = (AntenaOrdenada*)malloc(n * sizeof(AntenaOrdenada));
+    AntenaOrdenada* porY = (AntenaOrdenada*)malloc(n * sizeof(AntenaOrdenada));
+    int* posX = (int*)malloc(n * sizeof(int));   // Posição de cada antena em porX
+    int* posY = (int*)malloc(n * sizeof(int));   // Posição de cada antena em porY
+    if (!porX || !porY || !posX || !posY) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        free(porX); free(porY); free(posX); free(posY);
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    int i = 0;
+    for (Vertice* v = lista; v; v = v->prox, i++) {
+        porX[i].x = v->x;
+        porX[i].y = v->y;
+        porX[i].frequencia = v->frequencia;
+        porX[i].ordem = i;
+        porY[i] = porX[i];
+    }
+    qsort(porX, n, sizeof(AntenaOrdenada), compararPorX);
+    qsort(porY, n, sizeof(AntenaOrdenada), compararPorY);
+    for (i = 0; i < n; i++) {
+        posX[porX[i].ordem] = i;
+        posY[porY[i].ordem] = i;
+    }
+
+    int erro = 0;
+    for (i = 0; i < n && !erro; i++) {
+        erro = efeitosDaAntena(porX, porY, posX, posY, n, i, tipo, c) < 0;
+    }
+    free(porX);
+    free(porY);
+    free(posX);
+    free(posY);
+    if (erro) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    return c;
+}
+#pragma endregion
+#pragma region Calcular Efeitos em Paralelo
+/**
+ * @brief Dados partilhados pelas tarefas de calcularEfeitosParalelo.
+ */
+typedef struct contextoEfeitos {
+    AntenaOrdenada* porX;
+    AntenaOrdenada* porY;
+    int* posX;
+    int* posY;
+    int n;
+    int inicio[257];             // Início de cada frequência nos vetores ordenados
+    TipoEfeito tipo;
+    int tamanhoFaixa;            // Antenas (seguidas na lista) por tarefa de procura
+    ConjuntoEfeitos** locais;    // Resultado de cada faixa (NULL em caso de erro)
+} ContextoEfeitos;
+
+/**
+ * @brief Tarefa de ordenação: ordena uma frequência por X (tarefa par) ou por Y (tarefa ímpar).
+ */
+static void ordenarFrequencia(void* contexto, int tarefa, int trabalhador) {
+    (void)trabalhador;
+    ContextoEfeitos* ctx = (ContextoEfeitos*)contexto;
+    int f = tarefa / 2;
+    int ini = ctx->inicio[f], fim = ctx->inicio[f + 1];
+    if (fim - ini == 0) return;
+    if (tarefa % 2 == 0) {
+        qsort(ctx->porX + ini, (size_t)(fim - ini), sizeof(AntenaOrdenada), compararPorX);
+        for (int k = ini; k < fim; k++) ctx->posX[ctx->porX[k].ordem] = k;
+    } else {
+        qsort(ctx->porY + ini, (size_t)(fim - ini), sizeof(AntenaOrdenada), compararPorY);
+        for (int k = ini; k < fim; k++) ctx->posY[ctx->porY[k].ordem] = k;
+    }
+}
+
+/**
+ * @brief Tarefa de procura: calcula os efeitos de uma faixa de antenas seguidas na lista
+ * (a lista está ordenada por linha, por isso cada faixa é um conjunto de linhas do mapa).
+ */
+static void procurarFaixa(void* contexto, int tarefa, int trabalhador) {
+    (void)trabalhador;
+    ContextoEfeitos* ctx = (ContextoEfeitos*)contexto;
+    int ini = tarefa * ctx->tamanhoFaixa;
+    int fim = ini + ctx->tamanhoFaixa < ctx->n ? ini + ctx->tamanhoFaixa : ctx->n;
+    ConjuntoEfeitos* local = criarConjuntoEfeitos(0);
+    if (!local) return;
+    for (int i = ini; i < fim; i++) {
+        if (efeitosDaAntena(ctx->porX, ctx->porY, ctx->posX, ctx->posY, ctx->n, i, ctx->tipo, local) < 0) {
+            libertarConjuntoEfeitos(local);
+            return;
+        }
+    }
+    ctx->locais[tarefa] = local;
+}
+
+/**
+ * @brief Calcula as posições com efeito nefasto usando várias threads.
+ *
+ * Dá o mesmo resultado, pela mesma ordem, que calcularEfeitos:
+ * - as antenas são separadas por frequência (ordenação por contagem) e cada frequência é
+ *   ordenada por X e por Y numa tarefa própria (as frequências são independentes);
+ * - a lista é dividida em faixas de antenas seguidas e cada faixa guarda os seus efeitos
+ *   num conjunto próprio, sem partilhar memória com as outras threads;
+ * - no fim os conjuntos das faixas são juntados pela ordem da lista, o que elimina as
+ *   posições repetidas entre faixas e mantém a ordem do cálculo sequencial.
+ * As tarefas são distribuídas com roubo de trabalho (executarTarefas).
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param tipo Regra a aplicar.
+ * @param numTrabalhadores Número de threads (0 ou negativo para usar todos os processadores).
+ * @return Conjunto com as posições afetadas, ou NULL em caso de erro.
+ */
+ConjuntoEfeitos* calcularEfeitosParalelo(Vertice* lista, TipoEfeito tipo, int numTrabalhadores) {
+    int trabalhadores = numeroTrabalhadores(numTrabalhadores);
+    int n = 0;
+    for (Vertice* v = lista; v; v = v->prox) n++;
+    if (trabalhadores == 1 || n < EFEITOS_MINIMO_PARALELO) {
+        return calcularEfeitos(lista, tipo);
+    }
+    ContextoEfeitos ctx;
+    ctx.n = n;
+    ctx.tipo = tipo;
+    ctx.porX = (AntenaOrdenada*)malloc(n * sizeof(AntenaOrdenada));
+    ctx.porY = (AntenaOrdenada*)malloc(n * sizeof(AntenaOrdenada));
+    ctx.posX = (int*)malloc(n * sizeof(int));
+    ctx.posY = (int*)malloc(n * sizeof(int));
+    // Faixas pequenas o suficiente para equilibrar as threads
+    ctx.tamanhoFaixa = n / (trabalhadores * 8);
+    if (ctx.tamanhoFaixa < 1024) ctx.tamanhoFaixa = 1024;
+    int numFaixas = (n + ctx.tamanhoFaixa - 1) / ctx.tamanhoFaixa;
+    ctx.locais = (ConjuntoEfeitos**)calloc((size_t)numFaixas, sizeof(ConjuntoEfeitos*));
+    ConjuntoEfeitos* c = criarConjuntoEfeitos(n);
+    if (!ctx.porX || !ctx.porY || !ctx.posX || !ctx.posY || !ctx.locais || !c) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        free(ctx.porX); free(ctx.porY); free(ctx.posX); free(ctx.posY); free(ctx.locais);
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    // Separar por frequência mantendo a ordem da lista
+    memset(ctx.inicio, 0, sizeof(ctx.inicio));
+    for (Vertice* v = lista; v; v = v->prox) {
+        ctx.inicio[(unsigned char)v->frequencia + 1]++;
+    }
+    for (int f = 0; f < 256; f++) {
+        ctx.inicio[f + 1] += ctx.inicio[f];
+    }
+    int livre[256];
+    memcpy(livre, ctx.inicio, sizeof(livre));
+    int i = 0;
+    for (Vertice* v = lista; v; v = v->prox, i++) {
+        AntenaOrdenada* a = &ctx.porX[livre[(unsigned char)v->frequencia]++];
+        a->x = v->x;
+        a->y = v->y;
+        a->frequencia = v->frequencia;
+        a->ordem = i;
+    }
+    memcpy(ctx.porY, ctx.porX, n * sizeof(AntenaOrdenada));
+
+    int erro = executarTarefas(512, ordenarFrequencia, &ctx, trabalhadores) < 0;
+    erro = erro || executarTarefas(numFaixas, procurarFaixa, &ctx, trabalhadores) < 0;
+    // Juntar os resultados das faixas pela ordem da lista
+    for (int t = 0; t < numFaixas && !erro; t++) {
+        ConjuntoEfeitos* local = ctx.locais[t];
+        if (!local) {
+            erro = 1;
+            break;
+        }
+        for (int k = 0; k < local->total && !erro; k++) {
+            erro = adicionarEfeito(c, local->celulas[k].x, local->celulas[k].y, local->direcao[k]) < 0;
+        }
+    }
+    for (int t = 0; t < numFaixas; t++) {
+        libertarConjuntoEfeitos(ctx.locais[t]);
+    }
+    free(ctx.locais);
+    free(ctx.porX);
+    free(ctx.porY);
+    free(ctx.posX);
+    free(ctx.posY);
+    if (erro) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    return c;
+}
+#pragma endregion
+#pragma region Rastreador Incremental
+/**
+ * @brief Cria um rastreador de efeitos vazio.
+ *
+ * @param capacidade Número de posições previsto (0 para o valor por omissão).
+ * @return Apontador para o rastreador, ou NULL em caso de erro de memória.
+ */
+RastreadorEfeitos* criarRastreadorEfeitos(int capacidade) {
+    RastreadorEfeitos* r = (RastreadorEfeitos*)malloc(sizeof(RastreadorEfeitos));
+    if (!r) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        return NULL;
+    }
+    int tamanho = EFEITOS_CAPACIDADE_MINIMA * 2;
+    while (tamanho < capacidade * 2) {
+        tamanho *= 2;
+    }
+    r->tabela = (CelulaEfeito*)calloc(tamanho, sizeof(CelulaEfeito));
+    if (!r->tabela) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        free(r);
+        return NULL;
+    }
+    r->tamanhoTabela = tamanho;
+    r->total = 0;
+    return r;
+}
+
+/**
+ * @brief Verifica se uma entrada da tabela do rastreador está livre.
+ */
+static int celulaLivre(const CelulaEfeito* e) {
+    return e->verticais == 0 && e->horizontais == 0;
+}
+
+/**
+ * @brief Duplica a tabela do rastreador e volta a distribuir as posições.
+ */
+static int aumentarRastreador(RastreadorEfeitos* r) {
+    int tamanho = r->tamanhoTabela * 2;
+    CelulaEfeito* tabela = (CelulaEfeito*)calloc(tamanho, sizeof(CelulaEfeito));
+    if (!tabela) return 0;
+    unsigned int mascara = (unsigned int)tamanho - 1;
+    for (int i = 0; i < r->tamanhoTabela; i++) {
+        if (celulaLivre(&r->tabela[i])) continue;
+        unsigned int p = dispersaoPosicao(r->tabela[i].x, r->tabela[i].y) & mascara;
+        while (!celulaLivre(&tabela[p])) {
+            p = (p + 1) & mascara;
+        }
+        tabela[p] = r->tabela[i];
+    }
+    free(r->tabela);
+    r->tabela = tabela;
+    r->tamanhoTabela = tamanho;
+    return 1;
+}
+
+/**
+ * @brief Liberta a entrada p, puxando para trás as entradas seguintes da mesma sequência
+ * (remoção sem marcas de apagado, para a tabela não se degradar com muitas remoções).
+ */
+static void apagarCelula(RastreadorEfeitos* r, unsigned int p) {
+    unsigned int mascara = (unsigned int)r->tamanhoTabela - 1;
+    unsigned int livre = p;
+    unsigned int j = p;
+    for (;;) {
+        j = (j + 1) & mascara;
+        if (celulaLivre(&r->tabela[j])) break;
+        unsigned int k = dispersaoPosicao(r->tabela[j].x, r->tabela[j].y) & mascara;
+        // A entrada j pode ocupar a posição livre se esta estiver entre k e j (circularmente)
+        int mover = livre <= j ? (k <= livre || k > j) : (k <= livre && k > j);
+        if (mover) {
+            r->tabela[livre] = r->tabela[j];
+            livre = j;
+        }
+    }
+    r->tabela[livre].verticais = 0;
+    r->tabela[livre].horizontais = 0;
+}
+
+/**
+ * @brief Soma delta ao contador de pares da posição (x, y) na direção indicada.
+ *
+ * A posição entra no conjunto quando o primeiro par a origina e sai quando o último
+ * par desaparece.
+ *
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int alterarCelula(RastreadorEfeitos* r, int x, int y, char direcao, int delta) {
+    unsigned int mascara = (unsigned int)r->tamanhoTabela - 1;
+    unsigned int p = dispersaoPosicao(x, y) & mascara;
+    while (!celulaLivre(&r->tabela[p]) && (r->tabela[p].x != x || r->tabela[p].y != y)) {
+        p = (p + 1) & mascara;
+    }
+    CelulaEfeito* e = &r->tabela[p];
+    if (celulaLivre(e)) {
+        if (delta < 0) return 0;     // Par que não estava registado
+        e->x = x;
+        e->y = y;
+        r->total++;
+    }
+    if (direcao == DIRECAO_MESMO_X) {
+        e->verticais += delta;
+    } else {
+        e->horizontais += delta;
+    }
+    if (celulaLivre(e)) {
+        r->total--;
+        apagarCelula(r, p);
+    } else if (r->total * 2 > r->tamanhoTabela && !aumentarRastreador(r)) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Soma delta às posições entre a antena e as antenas da mesma frequência a 2 posições.
+ *
+ * @param completo 1 para os quatro sentidos; 0 só para y + 2 e x + 2 (cada par é contado uma vez
+ * quando se percorre uma lista inteira).
+ */
+static int parceirosAntena(RastreadorEfeitos* r, IndiceAntenas* indice, Vertice* v, int delta, int completo) {
+    int erro = 0;
+    if (procurarAntenaIndice(indice, v->frequencia, v->x, v->y + 2)) {
+        erro |= alterarCelula(r, v->x, v->y + 1, DIRECAO_MESMO_X, delta);
+    }
+    if (procurarAntenaIndice(indice, v->frequencia, v->x + 2, v->y)) {
+        erro |= alterarCelula(r, v->x + 1, v->y, DIRECAO_MESMO_Y, delta);
+    }
+    if (completo && procurarAntenaIndice(indice, v->frequencia, v->x, v->y - 2)) {
+        erro |= alterarCelula(r, v->x, v->y - 1, DIRECAO_MESMO_X, delta);
+    }
+    if (completo && procurarAntenaIndice(indice, v->frequencia, v->x - 2, v->y)) {
+        erro |= alterarCelula(r, v->x - 1, v->y, DIRECAO_MESMO_Y, delta);
+    }
+    return erro ? -1 : 0;
+}
+
+/**
+ * @brief Regista os efeitos de uma antena acabada de inserir na lista e no índice.
+ *
+ * Só são consultadas as quatro posições a 2 de distância na mesma linha e coluna
+ * (regra EFEITO_DISTANCIA_2), por isso o custo é O(1) em vez de recalcular tudo.
+ *
+ * @param r Rastreador.
+ * @param indice Índice de coordenadas que já contém a antena.
+ * @param v Antena inserida.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+int registarAntenaEfeitos(RastreadorEfeitos* r, IndiceAntenas* indice, Vertice* v) {
+    if (!r || !indice || !v) return -1;
+    return parceirosAntena(r, indice, v, 1, 1);
+}
+
+/**
+ * @brief Retira os efeitos dos pares formados por uma antena que vai ser removida.
+ *
+ * As posições continuam afetadas enquanto houver outro par que as origine (contagem
+ * de referências por posição).
+ *
+ * @param r Rastreador.
+ * @param indice Índice de coordenadas.
+ * @param v Antena a remover.
+ * @return 0 em caso de sucesso.
+ */
+int retirarAntenaEfeitos(RastreadorEfeitos* r, IndiceAntenas* indice, Vertice* v) {
+    if (!r || !indice || !v) return -1;
+    return parceirosAntena(r, indice, v, -1, 1);
+}
+
+/**
+ * @brief Cria o rastreador de uma lista e associa-o ao índice de coordenadas.
+ *
+ * A partir daqui InsereAntenaIndexada e removeAntenaIndexada mantêm os efeitos
+ * atualizados, e o rastreador é libertado com o índice (libertarIndice).
+ *
+ * @param indice Índice de coordenadas da lista.
+ * @param lista Apontador para o início da lista de antenas.
+ * @return Rastreador associado, ou NULL em caso de erro.
+ */
+RastreadorEfeitos* ativarRastreadorEfeitos(IndiceAntenas* indice, Vertice* lista) {
+    if (!indice) return NULL;
+    if (indice->efeitos) return indice->efeitos;
+    RastreadorEfeitos* r = criarRastreadorEfeitos(0);
+    if (!r) return NULL;
+    for (Vertice* v = lista; v; v = v->prox) {
+        if (parceirosAntena(r, indice, v, 1, 0) < 0) {
+            printf("Erro ao alocar memória para os efeitos!\n");
+            libertarRastreadorEfeitos(r);
+            return NULL;
+        }
+    }
+    indice->efeitos = r;
+    return r;
+}
+
+/**
+ * @brief Indica quantos pares de antenas afetam a posição (x, y).
+ *
+ * @param r Rastreador.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Número de pares (0 se a posição não tiver efeito nefasto).
+ */
+int efeitoAtivo(RastreadorEfeitos* r, int x, int y) {
+    if (!r) return 0;
+    unsigned int mascara = (unsigned int)r->tamanhoTabela - 1;
+    unsigned int p = dispersaoPosicao(x, y) & mascara;
+    while (!celulaLivre(&r->tabela[p])) {
+        if (r->tabela[p].x == x && r->tabela[p].y == y) {
+            return r->tabela[p].verticais + r->tabela[p].horizontais;
+        }
+        p = (p + 1) & mascara;
+    }
+    return 0;
+}
+
+/**
+ * @brief Compara posições por (x, y).
+ */
+static int compararCelulas(const void* a, const void* b) {
+    const CelulaEfeito* p = (const CelulaEfeito*)a;
+    const CelulaEfeito* q = (const CelulaEfeito*)b;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    return (p->y > q->y) - (p->y < q->y);
+}
+
+/**
+ * @brief Copia as posições afetadas para um conjunto de efeitos (por ordem de x, y).
+ *
+ * Uma posição originada nas duas direções fica marcada como "Horizontal", como em calcularEfeitos.
+ *
+ * @param r Rastreador.
+ * @return Conjunto com as mesmas posições que calcularEfeitos(lista, EFEITO_DISTANCIA_2), ou NULL em caso de erro.
+ */
+ConjuntoEfeitos* exportarEfeitos(RastreadorEfeitos* r) {
+    if (!r) return NULL;
+    ConjuntoEfeitos* c = criarConjuntoEfeitos(r->total);
+    CelulaEfeito* celulas = (CelulaEfeito*)malloc((size_t)(r->total > 0 ? r->total : 1) * sizeof(CelulaEfeito));
+    if (!c || !celulas) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        libertarConjuntoEfeitos(c);
+        free(celulas);
+        return NULL;
+    }
+    int n = 0;
+    for (int i = 0; i < r->tamanhoTabela; i++) {
+        if (!celulaLivre(&r->tabela[i])) celulas[n++] = r->tabela[i];
+    }
+    qsort(celulas, (size_t)n, sizeof(CelulaEfeito), compararCelulas);
+    int erro = 0;
+    for (int i = 0; i < n && !erro; i++) {
+        char direcao = celulas[i].horizontais > 0 ? DIRECAO_MESMO_Y : DIRECAO_MESMO_X;
+        erro = adicionarEfeito(c, celulas[i].x, celulas[i].y, direcao) < 0;
+    }
+    free(celulas);
+    if (erro) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    return c;
+}
+
+/**
+ * @brief Liberta a memória do rastreador de efeitos.
+ *
+ * @param r Rastreador.
+ * @return 0 em caso de sucesso.
+ */
+int libertarRastreadorEfeitos(RastreadorEfeitos* r) {
+    if (!r) return 0;
+    free(r->tabela);
+    free(r);
+    return 0;
+}
+#pragma endregion
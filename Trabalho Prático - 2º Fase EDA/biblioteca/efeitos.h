@@ -0,0 +1,190 @@
+/**
+ * @file efeitos.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Cálculo dos efeitos nefastos agrupando as antenas por frequência, linha e coluna
+ * @version 0.1
+ * @date 2025-05-24
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef EFEITOS_H
+#define EFEITOS_H
+
+#include "grafo.h"
+
+/**
+ * @brief Par de coordenadas (x, y).
+ */
+typedef struct coordenada {
+    int x, y;
+} Coordenada;
+
+/**
+ * @brief Regra usada para deduzir os efeitos nefastos.
+ */
+typedef enum tipoEfeito {
+    EFEITO_DISTANCIA_2,          // Antenas a exatamente 2 posições (calcularEfeitosNefastos)
+    EFEITO_DISTANCIA_PAR         // Antenas a uma distância par (deduzirEfeitosNefastos da 1.ª fase)
+} TipoEfeito;
+
+/**
+ * @brief Alinhamento das antenas que originaram um efeito.
+ */
+typedef enum direcaoEfeito {
+    DIRECAO_MESMO_X = 'V',       // Antenas com a mesma coordenada X ("Vertical")
+    DIRECAO_MESMO_Y = 'H',       // Antenas com a mesma coordenada Y ("Horizontal")
+    DIRECAO_DIAGONAL = 'D'       // Antenas alinhadas noutra direção ("Diagonal", ver regras.h)
+} DirecaoEfeito;
+
+/**
+ * @brief Conjunto de posições com efeito nefasto, sem repetições e sem limite de tamanho.
+ *
+ * As posições ficam no vetor "celulas" pela ordem em que foram encontradas;
+ * a tabela de dispersão guarda, para cada posição, o seu índice no vetor mais 1 (0 = livre).
+ */
+typedef struct conjuntoEfeitos {
+    Coordenada* celulas;         // Posições pela ordem em que foram encontradas
+    char* direcao;               // Alinhamento que originou cada posição
+    int total;                   // Número de posições
+    int capacidade;              // Espaço reservado nos vetores
+    int* tabela;                 // Tabela de dispersão
+    int tamanhoTabela;           // Potência de 2
+} ConjuntoEfeitos;
+
+/**
+ * @brief Cria um conjunto de efeitos vazio
+ * @param capacidade Número de posições previsto (0 para o valor por omissão)
+ * @return Apontador para o conjunto, ou NULL em caso de erro
+ */
+ConjuntoEfeitos* criarConjuntoEfeitos(int capacidade);
+
+/**
+ * @brief Acrescenta uma posição ao conjunto, se ainda não existir
+ * @param c Conjunto de efeitos
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @param direcao Alinhamento que originou o efeito
+ * @return 1 se foi acrescentada, 0 se já existia, -1 em caso de erro de memória
+ */
+int adicionarEfeito(ConjuntoEfeitos* c, int x, int y, char direcao);
+
+/**
+ * @brief Verifica se uma posição pertence ao conjunto
+ * @param c Conjunto de efeitos
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return 1 se existir, 0 caso contrário
+ */
+int contemEfeito(ConjuntoEfeitos* c, int x, int y);
+
+/**
+ * @brief Muda o alinhamento de uma posição que já pertence ao conjunto
+ * @param c Conjunto de efeitos
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @param direcao Novo alinhamento
+ * @return 1 se a posição existir, 0 caso contrário
+ */
+int alterarDirecaoEfeito(ConjuntoEfeitos* c, int x, int y, char direcao);
+
+/**
+ * @brief Liberta a memória do conjunto
+ * @param c Conjunto de efeitos
+ * @return 0 em caso de sucesso
+ */
+int libertarConjuntoEfeitos(ConjuntoEfeitos* c);
+
+/**
+ * @brief Calcula as posições com efeito nefasto segundo uma regra
+ * @param lista Lista de antenas
+ * @param tipo Regra a aplicar
+ * @return Conjunto com as posições afetadas, ou NULL em caso de erro
+ */
+ConjuntoEfeitos* calcularEfeitos(Vertice* lista, TipoEfeito tipo);
+
+/**
+ * @brief Calcula as posições com efeito nefasto dividindo o trabalho por várias threads
+ * @param lista Lista de antenas
+ * @param tipo Regra a aplicar
+ * @param numTrabalhadores Número de threads (0 para usar todos os processadores)
+ * @return Conjunto com as mesmas posições, pela mesma ordem, que calcularEfeitos, ou NULL em caso de erro
+ */
+ConjuntoEfeitos* calcularEfeitosParalelo(Vertice* lista, TipoEfeito tipo, int numTrabalhadores);
+
+/**
+ * @brief Posição afetada no rastreador incremental, com o número de pares que a originam.
+ */
+typedef struct celulaEfeito {
+    int x, y;
+    int verticais;               // Pares com o mesmo X a 2 posições
+    int horizontais;             // Pares com o mesmo Y a 2 posições (entrada livre se ambos forem 0)
+} CelulaEfeito;
+
+/**
+ * @brief Efeitos nefastos (regra EFEITO_DISTANCIA_2) mantidos a cada inserção e remoção.
+ */
+typedef struct rastreadorEfeitos {
+    CelulaEfeito* tabela;        // Tabela de dispersão (endereçamento aberto)
+    int tamanhoTabela;           // Potência de 2
+    int total;                   // Número de posições afetadas
+} RastreadorEfeitos;
+
+/**
+ * @brief Cria um rastreador vazio
+ * @param capacidade Número de posições previsto (0 para o valor por omissão)
+ * @return Apontador para o rastreador, ou NULL em caso de erro
+ */
+RastreadorEfeitos* criarRastreadorEfeitos(int capacidade);
+
+/**
+ * @brief Cria o rastreador de uma lista e associa-o ao índice (atualizado por InsereAntenaIndexada e removeAntenaIndexada)
+ * @param indice Índice de coordenadas da lista
+ * @param lista Lista de antenas
+ * @return Rastreador associado, ou NULL em caso de erro
+ */
+RastreadorEfeitos* ativarRastreadorEfeitos(IndiceAntenas* indice, Vertice* lista);
+
+/**
+ * @brief Regista os efeitos de uma antena acabada de inserir
+ * @param r Rastreador
+ * @param indice Índice de coordenadas (já com a antena)
+ * @param v Antena inserida
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+int registarAntenaEfeitos(RastreadorEfeitos* r, IndiceAntenas* indice, Vertice* v);
+
+/**
+ * @brief Retira os efeitos de uma antena que vai ser removida
+ * @param r Rastreador
+ * @param indice Índice de coordenadas
+ * @param v Antena a remover
+ * @return 0 em caso de sucesso
+ */
+int retirarAntenaEfeitos(RastreadorEfeitos* r, IndiceAntenas* indice, Vertice* v);
+
+/**
+ * @brief Número de pares de antenas que afetam uma posição
+ * @param r Rastreador
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Número de pares (0 se a posição não for afetada)
+ */
+int efeitoAtivo(RastreadorEfeitos* r, int x, int y);
+
+/**
+ * @brief Copia as posições afetadas para um conjunto de efeitos, ordenadas por (x, y)
+ * @param r Rastreador
+ * @return Conjunto de efeitos, ou NULL em caso de erro
+ */
+ConjuntoEfeitos* exportarEfeitos(RastreadorEfeitos* r);
+
+/**
+ * @brief Liberta o rastreador
+ * @param r Rastreador
+ * @return 0 em caso de sucesso
+ */
+int libertarRastreadorEfeitos(RastreadorEfeitos* r);
+
+#endif
@@ -0,0 +1,301 @@
+/**
+ * @file faixas.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação do processamento do mapa por faixas de linhas
+ * @version 0.1
+ * @date 2025-06-11
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "faixas.h"
+#include "leitura.h"
+
+#define FAIXAS_TAMANHO_BLOCO (1 << 20)  // Bytes lidos do ficheiro de cada vez
+
+/**
+ * @brief Linha do mapa guardada em memória.
+ */
+typedef struct linhaMapa {
+    char* dados;
+    int comprimento;
+    int capacidade;
+} LinhaMapa;
+
+/**
+ * @brief Leitura do ficheiro por blocos, linha a linha.
+ */
+typedef struct leitorLinhas {
+    FILE* ficheiro;
+    char* bloco;
+    size_t pos, fim;             // Parte do bloco ainda por usar
+} LeitorLinhas;
+
+/**
+ * @brief Vetor de colunas (posições com efeito numa linha).
+ */
+typedef struct colunas {
+    int* coluna;
+    int num;
+    int capacidade;
+} Colunas;
+
+/**
+ * @brief Faixa em construção.
+ */
+typedef struct faixaConstrucao {
+    FaixaMapa faixa;
+    Coordenada* efeitos;
+    char* direcao;
+    int capacidade;
+} FaixaConstrucao;
+
+#pragma region Leitura das Linhas
+/**
+ * @brief Acrescenta n bytes ao fim de uma linha, aumentando o espaço se for preciso.
+ */
+static int acrescentarLinha(LinhaMapa* l, const char* dados, size_t n) {
+    if (n == 0) return 1;
+    if ((size_t)l->comprimento + n > (size_t)l->capacidade) {
+        size_t capacidade = l->capacidade ? (size_t)l->capacidade : 256;
+        while (capacidade < (size_t)l->comprimento + n) capacidade *= 2;
+        if (capacidade > 0x7FFFFFFF) return 0;
+        char* novos = (char*)realloc(l->dados, capacidade);
+        if (!novos) return 0;
+        l->dados = novos;
+        l->capacidade = (int)capacidade;
+    }
+    memcpy(l->dados + l->comprimento, dados, n);
+    l->comprimento += (int)n;
+    return 1;
+}
+
+/**
+ * @brief Lê a próxima linha do ficheiro (sem o '\n' nem o '\r' final).
+ *
+ * Os bytes são lidos em blocos de FAIXAS_TAMANHO_BLOCO e o fim de cada linha é
+ * procurado com memchr; só é copiada para a linha a parte que lhe pertence.
+ *
+ * @param leitor Leitor do ficheiro.
+ * @param l Linha onde fica o conteúdo.
+ * @return 1 se foi lida uma linha, 0 no fim do ficheiro, -1 em caso de erro de memória.
+ */
+static int lerLinha(LeitorLinhas* leitor, LinhaMapa* l) {
+    int lida = 0;
+    l->comprimento = 0;
+    for (;;) {
+        if (leitor->pos == leitor->fim) {
+            leitor->fim = fread(leitor->bloco, 1, FAIXAS_TAMANHO_BLOCO, leitor->ficheiro);
+            leitor->pos = 0;
+            if (leitor->fim == 0) break;  // Fim do ficheiro
+        }
+        const char* inicio = leitor->bloco + leitor->pos;
+        size_t resto = leitor->fim - leitor->pos;
+        const char* fimLinha = (const char*)memchr(inicio, '\n', resto);
+        size_t n = fimLinha ? (size_t)(fimLinha - inicio) : resto;
+        if (!acrescentarLinha(l, inicio, n)) return -1;
+        lida = 1;
+        leitor->pos += n;
+        if (fimLinha) {
+            leitor->pos++;  // Salta o '\n'
+            break;
+        }
+    }
+    if (l->comprimento > 0 && l->dados[l->comprimento - 1] == '\r') l->comprimento--;
+    return lida;
+}
+#pragma endregion
+#pragma region Efeitos de uma Linha
+/**
+ * @brief Caracter da coluna c de uma linha ('.' se a linha for mais curta).
+ */
+static char celula(const LinhaMapa* l, int c) {
+    return c >= 0 && c < l->comprimento ? l->dados[c] : '.';
+}
+
+/**
+ * @brief Verifica se um caracter do mapa é uma antena.
+ */
+static int eAntena(char c) {
+    return c != '.' && c != ' ' && c != '\r';
+}
+
+/**
+ * @brief Acrescenta uma coluna ao vetor.
+ */
+static int acrescentarColuna(Colunas* v, int coluna) {
+    if (v->num == v->capacidade) {
+        int capacidade = v->capacidade ? v->capacidade * 2 : 64;
+        int* novas = (int*)realloc(v->coluna, (size_t)capacidade * sizeof(int));
+        if (!novas) return 0;
+        v->coluna = novas;
+        v->capacidade = capacidade;
+    }
+    v->coluna[v->num++] = coluna;
+    return 1;
+}
+
+/**
+ * @brief Acrescenta uma posição com efeito à faixa em construção.
+ */
+static int acrescentarEfeitoFaixa(FaixaConstrucao* f, int x, int y, char direcao) {
+    if (f->faixa.numEfeitos == f->capacidade) {
+        int capacidade = f->capacidade ? f->capacidade * 2 : 256;
+        Coordenada* efeitos = (Coordenada*)realloc(f->efeitos, (size_t)capacidade * sizeof(Coordenada));
+        if (!efeitos) return 0;
+        f->efeitos = efeitos;
+        char* direcao2 = (char*)realloc(f->direcao, (size_t)capacidade);
+        if (!direcao2) return 0;
+        f->direcao = direcao2;
+        f->capacidade = capacidade;
+    }
+    f->efeitos[f->faixa.numEfeitos].x = x;
+    f->efeitos[f->faixa.numEfeitos].y = y;
+    f->direcao[f->faixa.numEfeitos] = direcao;
+    f->faixa.numEfeitos++;
+    return 1;
+}
+
+/**
+ * @brief Conta as antenas da linha atual e calcula os efeitos nefastos que nela caem.
+ *
+ * Com a regra EFEITO_DISTANCIA_2 um efeito na linha r só depende das linhas r - 1, r e r + 1:
+ * - duas antenas iguais nas colunas c - 1 e c + 1 da linha r (mesmo X, "Vertical");
+ * - duas antenas iguais na coluna c das linhas r - 1 e r + 1 (mesmo Y, "Horizontal").
+ * As duas listas de colunas já saem ordenadas e são juntadas por ordem de coluna. Uma
+ * posição originada nas duas direções fica "Horizontal", como em calcularEfeitos (a
+ * antena da linha anterior aparece primeiro na lista).
+ *
+ * @param anterior Linha r - 1 (vazia na primeira linha).
+ * @param atual Linha r.
+ * @param seguinte Linha r + 1 (vazia na última linha).
+ * @param x Coordenada X da linha r.
+ * @param f Faixa em construção.
+ * @param verticais Memória de trabalho.
+ * @param horizontais Memória de trabalho.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int processarLinha(const LinhaMapa* anterior, const LinhaMapa* atual, const LinhaMapa* seguinte,
+                          int x, FaixaConstrucao* f, Colunas* verticais, Colunas* horizontais) {
+    verticais->num = 0;
+    horizontais->num = 0;
+    if (atual->comprimento > f->faixa.largura) f->faixa.largura = atual->comprimento;
+    const char* fim = atual->comprimento > 0 ? atual->dados + atual->comprimento : atual->dados;
+    for (const char* p = procurarDiferenteDePonto(atual->dados, fim); p < fim;
+         p = procurarDiferenteDePonto(p + 1, fim)) {
+        if (!eAntena(*p)) continue;
+        int c = (int)(p - atual->dados);
+        f->faixa.numAntenas++;
+        f->faixa.antenasFrequencia[(unsigned char)*p]++;
+        if (celula(atual, c + 2) == *p && !acrescentarColuna(verticais, c + 1)) return -1;
+    }
+    fim = anterior->comprimento > 0 ? anterior->dados + anterior->comprimento : anterior->dados;
+    for (const char* p = procurarDiferenteDePonto(anterior->dados, fim); p < fim;
+         p = procurarDiferenteDePonto(p + 1, fim)) {
+        int c = (int)(p - anterior->dados);
+        if (eAntena(*p) && celula(seguinte, c) == *p && !acrescentarColuna(horizontais, c)) return -1;
+    }
+    int v = 0, h = 0;
+    while (v < verticais->num || h < horizontais->num) {
+        int ok;
+        if (h < horizontais->num && (v == verticais->num || horizontais->coluna[h] <= verticais->coluna[v])) {
+            if (v < verticais->num && verticais->coluna[v] == horizontais->coluna[h]) v++;
+            ok = acrescentarEfeitoFaixa(f, x, horizontais->coluna[h++] + 1, DIRECAO_MESMO_Y);
+        } else {
+            ok = acrescentarEfeitoFaixa(f, x, verticais->coluna[v++] + 1, DIRECAO_MESMO_X);
+        }
+        if (!ok) return -1;
+    }
+    return 0;
+}
+#pragma endregion
+#pragma region Processar por Faixas
+/**
+ * @brief Lê o mapa por faixas de linhas e calcula os efeitos e as estatísticas de cada faixa.
+ *
+ * O ficheiro (no formato de antenas.txt, com linhas de qualquer largura) é lido por blocos
+ * e só ficam em memória três linhas: a anterior, a atual e a seguinte, que é o halo
+ * suficiente para a regra EFEITO_DISTANCIA_2 (ver processarLinha). No fim de cada faixa
+ * de linhasPorFaixa linhas a função do utilizador recebe as estatísticas e os efeitos da
+ * faixa, que depois são descartados. A memória usada depende da largura do mapa e do
+ * tamanho das faixas, mas não do número de linhas, por isso o mapa pode ser maior do
+ * que a memória disponível.
+ *
+ * Juntando os efeitos de todas as faixas obtêm-se as mesmas posições que calcularEfeitos
+ * com EFEITO_DISTANCIA_2 sobre o mapa inteiro.
+ *
+ * @param nomeFicheiro Nome do ficheiro de texto do mapa.
+ * @param linhasPorFaixa Número de linhas de cada faixa (valores menores que 1 contam como 1).
+ * @param funcao Função chamada no fim de cada faixa (pode ser NULL).
+ * @param contexto Dados passados à função.
+ * @return Número de faixas processadas, ou -1 em caso de erro.
+ */
+int processarPorFaixas(const char* nomeFicheiro, int linhasPorFaixa, FuncaoFaixa funcao, void* contexto) {
+    if (!nomeFicheiro) return -1;
+    if (linhasPorFaixa < 1) linhasPorFaixa = 1;
+    FILE* ficheiro = fopen(nomeFicheiro, "rb");
+    if (!ficheiro) return -1;
+    LeitorLinhas leitor = { ficheiro, (char*)malloc(FAIXAS_TAMANHO_BLOCO), 0, 0 };
+    LinhaMapa linhas[3] = { { NULL, 0, 0 }, { NULL, 0, 0 }, { NULL, 0, 0 } };
+    LinhaMapa* anterior = &linhas[0];
+    LinhaMapa* atual = &linhas[1];
+    LinhaMapa* seguinte = &linhas[2];
+    Colunas verticais = { NULL, 0, 0 };
+    Colunas horizontais = { NULL, 0, 0 };
+    FaixaConstrucao f;
+    memset(&f, 0, sizeof(f));
+
+    int numFaixas = 0;
+    int erro = !leitor.bloco;
+    int lida = erro ? 0 : lerLinha(&leitor, atual);
+    if (lida < 0) erro = 1;
+    int linha = 0;  // Linha atual (a começar em 0)
+    while (lida > 0 && !erro) {
+        lida = lerLinha(&leitor, seguinte);
+        if (lida < 0) {
+            erro = 1;
+            break;
+        }
+        if (lida == 0) seguinte->comprimento = 0;
+        if (linha % linhasPorFaixa == 0) {
+            // Nova faixa: os efeitos da anterior já foram entregues
+            memset(&f.faixa, 0, sizeof(f.faixa));
+            f.faixa.numero = numFaixas;
+            f.faixa.linhaInicio = linha + 1;
+        }
+        if (processarLinha(anterior, atual, seguinte, linha + 1, &f, &verticais, &horizontais) < 0) {
+            erro = 1;
+            break;
+        }
+        if ((linha + 1) % linhasPorFaixa == 0 || lida == 0) {
+            f.faixa.linhaFim = linha + 1;
+            f.faixa.efeitos = f.efeitos;
+            f.faixa.direcao = f.direcao;
+            numFaixas++;
+            if (funcao && funcao(&f.faixa, contexto) != 0) break;
+        }
+        LinhaMapa* livre = anterior;
+        anterior = atual;
+        atual = seguinte;
+        seguinte = livre;
+        linha++;
+    }
+
+    fclose(ficheiro);
+    free(leitor.bloco);
+    for (int i = 0; i < 3; i++) free(linhas[i].dados);
+    free(verticais.coluna);
+    free(horizontais.coluna);
+    free(f.efeitos);
+    free(f.direcao);
+    if (erro) {
+        printf("Erro ao alocar memória para as faixas do mapa!\n");
+        return -1;
+    }
+    return numFaixas;
+}
+#pragma endregion
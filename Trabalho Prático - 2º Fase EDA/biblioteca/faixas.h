@@ -0,0 +1,49 @@
+/**
+ * @file faixas.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Processamento do mapa por faixas de linhas, sem o carregar todo para memória
+ * @version 0.1
+ * @date 2025-06-11
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef FAIXAS_H
+#define FAIXAS_H
+
+#include "efeitos.h"
+
+/**
+ * @brief Resultado de uma faixa de linhas do mapa, entregue à função do utilizador.
+ */
+typedef struct faixaMapa {
+    int numero;                        // Número da faixa (0, 1, ...)
+    int linhaInicio, linhaFim;         // Primeira e última linha da faixa (coordenada X, a começar em 1)
+    int largura;                       // Maior número de colunas das linhas da faixa
+    long long numAntenas;              // Antenas nas linhas da faixa
+    long long antenasFrequencia[256];  // Antenas de cada frequência
+    int numEfeitos;                    // Posições com efeito nefasto (regra EFEITO_DISTANCIA_2)
+    const Coordenada* efeitos;         // Ordenadas por (x, y)
+    const char* direcao;               // Alinhamento que originou cada posição
+} FaixaMapa;
+
+/**
+ * @brief Função chamada no fim de cada faixa
+ * @param faixa Resultado da faixa (só é válido durante a chamada)
+ * @param contexto Dados do utilizador
+ * @return 0 para continuar, outro valor para parar
+ */
+typedef int (*FuncaoFaixa)(const FaixaMapa* faixa, void* contexto);
+
+/**
+ * @brief Lê o mapa por faixas de linhas e calcula os efeitos e as estatísticas de cada faixa
+ * @param nomeFicheiro Nome do ficheiro de texto do mapa
+ * @param linhasPorFaixa Número de linhas de cada faixa
+ * @param funcao Função chamada no fim de cada faixa
+ * @param contexto Dados passados à função
+ * @return Número de faixas processadas, ou -1 em caso de erro
+ */
+int processarPorFaixas(const char* nomeFicheiro, int linhasPorFaixa, FuncaoFaixa funcao, void* contexto);
+
+#endif
@@ -0,0 +1,411 @@
+/**
+ * @file formatos.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da leitura dos formatos esparsos do mapa de antenas
+ * @version 0.1
+ * @date 2025-06-12
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "formatos.h"
+#include "leitura.h"
+#include "memoria.h"
+#include "saida.h"
+
+#define FORMATOS_TAMANHO_ESCRITA (1 << 20)  // Bytes juntados antes de cada escrita
+
+/**
+ * @brief Registo lido de um ficheiro no formato FORMATO_REGISTOS.
+ */
+typedef struct registoAntena {
+    int x, y;
+    char frequencia;             // '-' numa marca de remoção
+    int ordem;                   // Posição do registo no ficheiro
+    int existe;                  // Usado ao aplicar as remoções
+} RegistoAntena;
+
+#pragma region Auxiliares
+/**
+ * @brief Lê um inteiro em texto decimal, com sinal opcional.
+ *
+ * Não usa strtol nem sscanf (que dependem do locale e precisam de texto terminado em
+ * '\0'), por isso pode ler diretamente do ficheiro mapeado em memória.
+ *
+ * @param p Apontador para a posição atual (avança para depois do número).
+ * @param fim Fim do texto.
+ * @param valor Onde fica o número.
+ * @return 1 se foi lido um número, 0 se não houver algarismos ou o número não couber num int.
+ */
+int lerInteiro(const char** p, const char* fim, int* valor) {
+    const char* c = *p;
+    int negativo = 0;
+    if (c < fim && (*c == '-' || *c == '+')) {
+        negativo = *c == '-';
+        c++;
+    }
+    if (c >= fim || *c < '0' || *c > '9') return 0;
+    long long v = 0;
+    while (c < fim && *c >= '0' && *c <= '9') {
+        v = v * 10 + (*c - '0');
+        if (v > (long long)INT_MAX + 1) return 0;
+        c++;
+    }
+    if (negativo) v = -v;
+    if (v > INT_MAX || v < INT_MIN) return 0;
+    *valor = (int)v;
+    *p = c;
+    return 1;
+}
+
+/**
+ * @brief Salta espaços e tabulações.
+ */
+static const char* saltarEspacos(const char* p, const char* fim) {
+    while (p < fim && (*p == ' ' || *p == '\t')) p++;
+    return p;
+}
+
+/**
+ * @brief Lê um registo "f x y" ou "- x y" de uma linha (sem o '\n').
+ *
+ * @return 1 se a linha tiver um registo válido, 0 caso contrário.
+ */
+static int lerRegisto(const char* p, const char* fim, RegistoAntena* r) {
+    p = saltarEspacos(p, fim);
+    if (p >= fim) return 0;
+    r->frequencia = *p++;
+    if (p >= fim || (*p != ' ' && *p != '\t')) return 0;
+    p = saltarEspacos(p, fim);
+    if (!lerInteiro(&p, fim, &r->x)) return 0;
+    p = saltarEspacos(p, fim);
+    if (!lerInteiro(&p, fim, &r->y)) return 0;
+    p = saltarEspacos(p, fim);
+    return p == fim || (p + 1 == fim && *p == '\r');
+}
+
+/**
+ * @brief Liga uma antena no fim da lista.
+ */
+static void ligarNoFim(Vertice** lista, Vertice** cauda, Vertice* nova) {
+    nova->ant = *cauda;
+    if (*cauda) {
+        (*cauda)->prox = nova;
+    } else {
+        *lista = nova;
+    }
+    *cauda = nova;
+}
+
+/**
+ * @brief Compara registos por (x, y) e depois pela ordem no ficheiro.
+ */
+static int compararRegistos(const void* a, const void* b) {
+    const RegistoAntena* p = (const RegistoAntena*)a;
+    const RegistoAntena* q = (const RegistoAntena*)b;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    if (p->y != q->y) return p->y < q->y ? -1 : 1;
+    return (p->ordem > q->ordem) - (p->ordem < q->ordem);
+}
+#pragma endregion
+#pragma region Detetar Formato
+/**
+ * @brief Deteta o formato de um mapa pela primeira linha não vazia.
+ *
+ * - "#RLE" no início da linha: FORMATO_RLE;
+ * - um caracter, espaços e dois inteiros ("A 3 7" ou "- 3 7"): FORMATO_REGISTOS;
+ * - qualquer outra coisa: FORMATO_GRELHA.
+ *
+ * @param dados Conteúdo do ficheiro.
+ * @param tamanho Número de bytes.
+ * @return Formato detetado.
+ */
+FormatoMapa detetarFormato(const char* dados, size_t tamanho) {
+    if (!dados) return FORMATO_GRELHA;
+    const char* p = dados;
+    const char* fim = dados + tamanho;
+    while (p < fim) {
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fim - p));
+        if (!fimLinha) fimLinha = fim;
+        const char* c = saltarEspacos(p, fimLinha);
+        if (c < fimLinha && *c != '\r') {
+            size_t n = (size_t)(fimLinha - p);
+            if (n >= sizeof(CABECALHO_RLE) - 1 && memcmp(p, CABECALHO_RLE, sizeof(CABECALHO_RLE) - 1) == 0) {
+                return FORMATO_RLE;
+            }
+            RegistoAntena r;
+            return lerRegisto(p, fimLinha, &r) ? FORMATO_REGISTOS : FORMATO_GRELHA;
+        }
+        p = fimLinha + 1;
+    }
+    return FORMATO_GRELHA;
+}
+#pragma endregion
+#pragma region Ler Registos
+/**
+ * @brief Cria a lista de antenas a partir de registos "f x y" e marcas de remoção "- x y".
+ *
+ * É o formato do diário "antenas2.txt" da 1.ª fase: as antenas podem estar por qualquer
+ * ordem e uma marca "- x y" retira a antena mais recente ainda existente nessa posição,
+ * a mesma que removeAntena retira da lista (InsereAntena põe as novas à frente).
+ * Os registos são lidos com lerInteiro, ordenados por (x, y, ordem no ficheiro) e cada
+ * posição é resolvida de uma vez; uma antena repetida (mesma frequência e posição) só
+ * conta uma vez, como em InsereAntena. A lista fica ordenada por (x, y), com as antenas
+ * mais recentes primeiro quando há várias na mesma posição (a ordem de InsereAntena).
+ * O custo depende só do número de registos, não da área do mapa. Linhas vazias são
+ * ignoradas; as linhas inválidas são ignoradas e contadas.
+ *
+ * @param dados Conteúdo do ficheiro.
+ * @param tamanho Número de bytes.
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc).
+ * @return Lista de antenas, ou NULL se não houver antenas ou em caso de erro.
+ */
+Vertice* lerRegistos(const char* dados, size_t tamanho, ArenaGrafo* arena) {
+    if (!dados) return NULL;
+    int num = 0, capacidade = 1024, invalidos = 0;
+    RegistoAntena* registos = (RegistoAntena*)malloc((size_t)capacidade * sizeof(RegistoAntena));
+    if (!registos) {
+        printf("Erro ao alocar memória para os registos!\n");
+        return NULL;
+    }
+    const char* p = dados;
+    const char* fim = dados + tamanho;
+    while (p < fim) {
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fim - p));
+        if (!fimLinha) fimLinha = fim;
+        const char* c = saltarEspacos(p, fimLinha);
+        if (c < fimLinha && *c != '\r') {
+            if (num == capacidade) {
+                capacidade *= 2;
+                RegistoAntena* novos = (RegistoAntena*)realloc(registos, (size_t)capacidade * sizeof(RegistoAntena));
+                if (!novos) {
+                    printf("Erro ao alocar memória para os registos!\n");
+                    free(registos);
+                    return NULL;
+                }
+                registos = novos;
+            }
+            if (lerRegisto(c, fimLinha, &registos[num])) {
+                registos[num].ordem = num;
+                num++;
+            } else {
+                invalidos++;
+            }
+        }
+        p = fimLinha + 1;
+    }
+    if (invalidos > 0) {
+        printf("Foram ignorados %d registos inválidos!\n", invalidos);
+    }
+    qsort(registos, (size_t)num, sizeof(RegistoAntena), compararRegistos);
+
+    Vertice* lista = NULL;
+    Vertice* cauda = NULL;
+    for (int ini = 0; ini < num;) {
+        int fimGrupo = ini + 1;
+        while (fimGrupo < num && registos[fimGrupo].x == registos[ini].x && registos[fimGrupo].y == registos[ini].y) {
+            fimGrupo++;
+        }
+        // Aplicar os registos desta posição pela ordem do ficheiro
+        for (int k = ini; k < fimGrupo; k++) {
+            RegistoAntena* r = &registos[k];
+            r->existe = 0;
+            if (r->frequencia == '-') {
+                for (int j = k - 1; j >= ini; j--) {
+                    if (registos[j].existe) {
+                        registos[j].existe = 0;
+                        break;
+                    }
+                }
+                continue;
+            }
+            int repetida = 0;
+            for (int j = ini; j < k && !repetida; j++) {
+                repetida = registos[j].existe && registos[j].frequencia == r->frequencia;
+            }
+            r->existe = !repetida;
+        }
+        for (int k = fimGrupo - 1; k >= ini; k--) {
+            if (!registos[k].existe) continue;
+            Vertice* nova = criarAntenaArena(arena, registos[k].frequencia, registos[k].x, registos[k].y);
+            if (!nova) {
+                printf("Erro ao alocar memória para as antenas!\n");
+                free(registos);
+                if (!arena) libertarMemoria(lista);
+                return NULL;
+            }
+            ligarNoFim(&lista, &cauda, nova);
+        }
+        ini = fimGrupo;
+    }
+    free(registos);
+    return lista;
+}
+#pragma endregion
+#pragma region Ler RLE
+/**
+ * @brief Cria a lista de antenas a partir de um mapa com linhas comprimidas.
+ *
+ * Depois da linha "#RLE", cada linha de texto é uma linha do mapa. Cada posição é um
+ * caracter como em antenas.txt ('.' ou ' ' para vazio), mas "k*c" representa k cópias
+ * seguidas do caracter c (por exemplo "120*.A3*.B" são 120 posições vazias, uma antena A,
+ * 3 vazias e uma antena B). As posições vazias no fim de uma linha podem ser omitidas.
+ * Como os números só contam se forem seguidos de '*', as frequências podem ser algarismos.
+ * As repetições vazias são saltadas sem criar nada, por isso o custo depende do número de
+ * antenas e do tamanho do texto, não da largura do mapa.
+ *
+ * @param dados Conteúdo do ficheiro (com o cabeçalho "#RLE").
+ * @param tamanho Número de bytes.
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc).
+ * @return Lista de antenas, ou NULL se não houver antenas ou em caso de erro.
+ */
+Vertice* lerRLE(const char* dados, size_t tamanho, ArenaGrafo* arena) {
+    if (!dados) return NULL;
+    const char* p = dados;
+    const char* fim = dados + tamanho;
+    // Saltar até à linha do cabeçalho (inclusive)
+    while (p < fim) {
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fim - p));
+        if (!fimLinha) fimLinha = fim;
+        int cabecalho = (size_t)(fimLinha - p) >= sizeof(CABECALHO_RLE) - 1 &&
+                        memcmp(p, CABECALHO_RLE, sizeof(CABECALHO_RLE) - 1) == 0;
+        p = fimLinha + 1;
+        if (cabecalho) break;
+    }
+    Vertice* lista = NULL;
+    Vertice* cauda = NULL;
+    int linha = 0;
+    while (p < fim) {
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fim - p));
+        if (!fimLinha) fimLinha = fim;
+        long long coluna = 0;
+        const char* c = p;
+        while (c < fimLinha) {
+            long long repeticoes = 1;
+            if (*c >= '0' && *c <= '9') {
+                // Só é uma repetição se os algarismos forem seguidos de '*' e de um caracter
+                const char* d = c;
+                int k;
+                if (lerInteiro(&d, fimLinha, &k) && d + 1 < fimLinha && *d == '*') {
+                    repeticoes = k;
+                    c = d + 1;
+                }
+            }
+            char simbolo = *c++;
+            if (simbolo != '.' && simbolo != ' ' && simbolo != '\r') {
+                for (long long r = 0; r < repeticoes; r++) {
+                    if (coluna + r + 1 > INT_MAX) break;
+                    Vertice* nova = criarAntenaArena(arena, simbolo, linha + 1, (int)(coluna + r + 1));
+                    if (!nova) {
+                        printf("Erro ao alocar memória para as antenas!\n");
+                        if (!arena) libertarMemoria(lista);
+                        return NULL;
+                    }
+                    ligarNoFim(&lista, &cauda, nova);
+                }
+            }
+            coluna += repeticoes;
+        }
+        p = fimLinha + 1;
+        linha++;
+    }
+    return lista;
+}
+#pragma endregion
+#pragma region Carregar e Guardar
+/**
+ * @brief Carrega as antenas de um ficheiro em qualquer dos formatos, detetando-o automaticamente.
+ *
+ * O ficheiro é mapeado em memória (mapearFicheiro) e lido pela função do formato
+ * detetado por detetarFormato: lerGrelha, lerRegistos ou lerRLE.
+ *
+ * @param nomeFicheiro Nome do ficheiro.
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc).
+ * @return Lista de antenas ordenada por (x, y), ou NULL se não houver antenas ou em caso de erro.
+ */
+Vertice* carregarAntenasAuto(const char* nomeFicheiro, ArenaGrafo* arena) {
+    FicheiroMapeado f;
+    if (!mapearFicheiro(nomeFicheiro, &f)) {
+        return NULL;
+    }
+    Vertice* lista;
+    switch (detetarFormato(f.dados, f.tamanho)) {
+    case FORMATO_REGISTOS:
+        lista = lerRegistos(f.dados, f.tamanho, arena);
+        break;
+    case FORMATO_RLE:
+        lista = lerRLE(f.dados, f.tamanho, arena);
+        break;
+    default:
+        lista = lerGrelha(f.dados, f.tamanho, arena);
+        break;
+    }
+    desmapearFicheiro(&f);
+    return lista;
+}
+
+/**
+ * @brief Acrescenta ao texto uma repetição de k posições vazias.
+ */
+static void acrescentarVazias(TextoSaida* t, int k) {
+    if (k == 1) {
+        acrescentarTexto(t, ".", 1);
+    } else if (k > 1) {
+        acrescentarInteiro(t, k);
+        acrescentarTexto(t, "*.", 2);
+    }
+}
+
+/**
+ * @brief Guarda as antenas da lista num ficheiro com linhas comprimidas (ver lerRLE).
+ *
+ * A lista tem de estar ordenada por (x, y), como fica depois de InsereAntena ou de
+ * qualquer das funções de leitura. As posições vazias seguidas são escritas como uma
+ * repetição "k*." e as frequências que são algarismos como "1*c", para não serem lidas
+ * como números. Só pode haver uma antena por posição e as coordenadas têm de ser
+ * positivas: as restantes antenas não são guardadas. O texto é juntado em memória e
+ * escrito em blocos.
+ *
+ * @param lista Lista de antenas.
+ * @param nomeFicheiro Nome do ficheiro.
+ * @return 0 em caso de sucesso, -1 em caso de erro.
+ */
+int guardarAntenasRLE(Vertice* lista, const char* nomeFicheiro) {
+    FILE* ficheiro = fopen(nomeFicheiro, "wb");
+    if (!ficheiro) {
+        printf("Erro ao abrir o ficheiro para guardar antenas!\n");
+        return -1;
+    }
+    TextoSaida t = { 0 };
+    int erro = 0;
+    acrescentarCadeia(&t, CABECALHO_RLE "\n");
+    int linha = 1, coluna = 0;  // Última posição escrita
+    for (Vertice* v = lista; v && !erro; v = v->prox) {
+        if (v->x < 1 || v->y < 1 || (v->x == linha && v->y <= coluna) || v->x < linha) continue;
+        while (linha < v->x) {
+            acrescentarTexto(&t, "\n", 1);
+            linha++;
+            coluna = 0;
+        }
+        acrescentarVazias(&t, v->y - coluna - 1);
+        if (v->frequencia >= '0' && v->frequencia <= '9') acrescentarTexto(&t, "1*", 2);
+        acrescentarTexto(&t, &v->frequencia, 1);
+        coluna = v->y;
+        if (t.tamanho >= FORMATOS_TAMANHO_ESCRITA) erro = escreverTexto(&t, ficheiro) < 0;
+    }
+    acrescentarTexto(&t, "\n", 1);
+    if (escreverTexto(&t, ficheiro) < 0) erro = 1;
+    libertarTexto(&t);
+    if (fclose(ficheiro) != 0) erro = 1;
+    if (erro) {
+        printf("Erro ao guardar as antenas!\n");
+        return -1;
+    }
+    return 0;
+}
+#pragma endregion
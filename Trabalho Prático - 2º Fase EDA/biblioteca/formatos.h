@@ -0,0 +1,80 @@
+/**
+ * @file formatos.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Formatos esparsos do mapa de antenas (registos "f x y" e linhas comprimidas) com deteção automática
+ * @version 0.1
+ * @date 2025-06-12
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef FORMATOS_H
+#define FORMATOS_H
+
+#include <stddef.h>
+#include "grafo.h"
+
+#define CABECALHO_RLE "#RLE"
+
+/**
+ * @brief Formatos de ficheiro do mapa.
+ */
+typedef enum formatoMapa {
+    FORMATO_GRELHA,              // Uma linha de texto por linha do mapa, '.' nas posições vazias (antenas.txt)
+    FORMATO_REGISTOS,            // Um registo "f x y" por antena e "- x y" para remover (antenas2.txt)
+    FORMATO_RLE                  // "#RLE" e depois uma linha por linha do mapa com repetições "12.A3.B"
+} FormatoMapa;
+
+/**
+ * @brief Lê um inteiro em texto decimal (com sinal opcional), sem depender do locale
+ * @param p Apontador para a posição atual (avança para depois do número)
+ * @param fim Fim do texto
+ * @param valor Onde fica o número
+ * @return 1 se foi lido um número, 0 caso contrário
+ */
+int lerInteiro(const char** p, const char* fim, int* valor);
+
+/**
+ * @brief Deteta o formato de um mapa pela primeira linha não vazia
+ * @param dados Conteúdo do ficheiro
+ * @param tamanho Número de bytes
+ * @return Formato detetado (FORMATO_GRELHA por omissão)
+ */
+FormatoMapa detetarFormato(const char* dados, size_t tamanho);
+
+/**
+ * @brief Cria a lista de antenas a partir de registos "f x y" e "- x y"
+ * @param dados Conteúdo do ficheiro
+ * @param tamanho Número de bytes
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc)
+ * @return Lista ordenada por (x, y), ou NULL se não houver antenas ou em caso de erro
+ */
+Vertice* lerRegistos(const char* dados, size_t tamanho, ArenaGrafo* arena);
+
+/**
+ * @brief Cria a lista de antenas a partir de um mapa com linhas comprimidas
+ * @param dados Conteúdo do ficheiro (com o cabeçalho "#RLE")
+ * @param tamanho Número de bytes
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc)
+ * @return Lista ordenada por (x, y), ou NULL se não houver antenas ou em caso de erro
+ */
+Vertice* lerRLE(const char* dados, size_t tamanho, ArenaGrafo* arena);
+
+/**
+ * @brief Carrega as antenas de um ficheiro em qualquer dos formatos, detetando-o automaticamente
+ * @param nomeFicheiro Nome do ficheiro
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc)
+ * @return Lista ordenada por (x, y), ou NULL se não houver antenas ou em caso de erro
+ */
+Vertice* carregarAntenasAuto(const char* nomeFicheiro, ArenaGrafo* arena);
+
+/**
+ * @brief Guarda as antenas da lista num ficheiro com linhas comprimidas
+ * @param lista Lista de antenas (ordenada por (x, y))
+ * @param nomeFicheiro Nome do ficheiro
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int guardarAntenasRLE(Vertice* lista, const char* nomeFicheiro);
+
+#endif
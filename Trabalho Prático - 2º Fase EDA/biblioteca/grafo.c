@@ -12,6 +12,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "grafo.h"
+#include "indice.h"
+#include "efeitos.h"
+#include "memoria.h"
+#include "snapshot.h"
+#include "paralelo.h"
+#include "quadtree.h"
+#include "intersecoes.h"
+#include "saida.h"
+
+#define GRAFO_ARESTAS_POR_TAREFA 16384   // Adjacências criadas por cada tarefa de CriarGrafoParalelo
 #pragma region Criar Grafo
 /**
  * @brief Cria as adjacências do grafo com base nos vértices (antenas) que possuem a mesma frequência.
@@ -43,6 +53,260 @@ Vertice* CriarGrafo(Vertice* lista) {
     return lista;
 }
 #pragma endregion
+#pragma region Agrupar por Frequência
+/**
+ * @brief Distribui os vértices por grupos de frequência (ordenação por contagem).
+ *
+ * Os vértices ficam seguidos no vetor devolvido, um grupo por cada valor possível de
+ * frequência, mantendo a ordem da lista dentro de cada grupo.
+ *
+ * @param lista Apontador para o início da lista de vértices.
+ * @param inicio Vetor com 257 posições: inicio[f] é a posição do primeiro vértice da frequência f.
+ * @return Vetor com os vértices agrupados (libertar com free), ou NULL em caso de erro.
+ */
+static Vertice** agruparPorFrequencia(Vertice* lista, int inicio[257]) {
+    int total = 0;
+    for (int f = 0; f < 257; f++) {
+        inicio[f] = 0;
+    }
+    for (Vertice* aux = lista; aux != NULL; aux = aux->prox) {
+        inicio[(unsigned char)aux->frequencia + 1]++;
+        total++;
+    }
+    for (int f = 0; f < 256; f++) {
+        inicio[f + 1] += inicio[f];
+    }
+    Vertice** grupos = (Vertice**)malloc((total > 0 ? total : 1) * sizeof(Vertice*));
+    if (!grupos) {
+        printf("Erro ao alocar memória para os grupos de frequência!\n");
+        return NULL;
+    }
+    int livre[256];
+    for (int f = 0; f < 256; f++) {
+        livre[f] = inicio[f];
+    }
+    for (Vertice* aux = lista; aux != NULL; aux = aux->prox) {
+        grupos[livre[(unsigned char)aux->frequencia]++] = aux;
+    }
+    return grupos;
+}
+
+/**
+ * @brief Liga o vértice grupos[i] a todos os outros vértices do seu grupo.
+ *
+ * As novas adjacências são acrescentadas no fim da lista de adjacências do vértice,
+ * pela ordem do grupo.
+ *
+ * @param grupos Vértices agrupados por frequência.
+ * @param inicioGrupo Posição do primeiro vértice do grupo.
+ * @param fimGrupo Posição a seguir ao último vértice do grupo.
+ * @param i Posição do vértice de origem.
+ * @param arena Arena onde são criadas as adjacências (NULL para usar malloc).
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int ligarAoGrupo(Vertice** grupos, int inicioGrupo, int fimGrupo, int i, ArenaGrafo* arena) {
+    Vertice* origem = grupos[i];
+    // Procurar a cauda uma única vez (pode já ter adjacências)
+    AdjD* cauda = origem->adjacencias;
+    while (cauda && cauda->next) {
+        cauda = cauda->next;
+    }
+    for (int j = inicioGrupo; j < fimGrupo; j++) {
+        if (j == i) continue;
+        AdjD* nova = criarAdjacenciaArena(arena, origem, grupos[j]);
+        if (!nova) {
+            return -1;
+        }
+        if (cauda) {
+            cauda->next = nova;
+        } else {
+            origem->adjacencias = nova;
+        }
+        cauda = nova;
+    }
+    return 0;
+}
+#pragma endregion
+#pragma region Criar Grafo por Frequência
+/**
+ * @brief Cria as mesmas adjacências que CriarGrafo, agrupando as antenas por frequência.
+ *
+ * Primeiro distribui os vértices por grupos, um por cada valor possível de frequência
+ * (no máximo 256), mantendo a ordem da lista dentro de cada grupo. Depois, para cada
+ * antena, liga-a às restantes do seu grupo acrescentando sempre no fim da lista de
+ * adjacências através de um apontador para a cauda. O custo passa a ser proporcional
+ * ao número de adjacências criadas em vez de N² comparações.
+ *
+ * @param lista Apontador para o início da lista ligada de vértices (antenas).
+ * @return Apontador para o início da lista, com as adjacências preenchidas.
+ */
+Vertice* CriarGrafoPorFrequencia(Vertice* lista) {
+    return CriarGrafoPorFrequenciaArena(lista, NULL);
+}
+
+/**
+ * @brief Cria as adjacências por frequência, reservando-as numa arena.
+ *
+ * Faz o mesmo que CriarGrafoPorFrequencia, mas as adjacências são retiradas da arena
+ * (blocos grandes libertados de uma só vez com libertarArena) em vez de um malloc
+ * por adjacência. Os vértices também têm de ter sido criados na arena (por exemplo com
+ * carregarAntenasMapeadoArena), para que todo o grafo seja libertado com libertarArena;
+ * caso contrário nenhuma adjacência é criada.
+ *
+ * @param lista Apontador para o início da lista ligada de vértices (antenas).
+ * @param arena Arena dos vértices onde são criadas as adjacências (NULL para usar malloc).
+ * @return Apontador para o início da lista, com as adjacências preenchidas.
+ */
+Vertice* CriarGrafoPorFrequenciaArena(Vertice* lista, ArenaGrafo* arena) {
+    if (lista == NULL) {
+        return NULL;
+    }
+    if (arena && !arenaContemLista(arena, lista)) {
+        printf("As antenas não pertencem à arena do grafo!\n");
+        return lista;
+    }
+    int inicio[257];  // inicio[f] = posição do primeiro vértice da frequência f
+    Vertice** grupos = agruparPorFrequencia(lista, inicio);
+    if (!grupos) {
+        return lista;
+    }
+    for (int f = 0; f < 256; f++) {
+        for (int i = inicio[f]; i < inicio[f + 1]; i++) {
+            if (ligarAoGrupo(grupos, inicio[f], inicio[f + 1], i, arena) < 0) {
+                printf("Erro ao alocar memória para a adjacência!\n");
+                free(grupos);
+                return lista;
+            }
+        }
+    }
+    free(grupos);
+    return lista;
+}
+#pragma endregion
+#pragma region Criar Grafo em Paralelo
+/**
+ * @brief Parte do trabalho de CriarGrafoParalelo: um conjunto de antenas seguidas de uma frequência.
+ */
+typedef struct tarefaGrafo {
+    int primeiro, ultimo;        // Antenas de origem (posições em grupos)
+    int inicioGrupo, fimGrupo;   // Limites do grupo da frequência
+} TarefaGrafo;
+
+/**
+ * @brief Dados partilhados pelas tarefas de CriarGrafoParalelo.
+ */
+typedef struct contextoGrafo {
+    Vertice** grupos;
+    TarefaGrafo* tarefas;
+    ArenaGrafo** arenas;         // Arena de cada thread (NULL se o grafo usar malloc)
+    int usarArena;
+    char* erro;                  // Erro de cada tarefa
+} ContextoGrafo;
+
+/**
+ * @brief Tarefa de CriarGrafoParalelo: liga cada antena da tarefa às restantes do seu grupo.
+ *
+ * Cada antena de origem pertence a uma só tarefa, por isso as listas de adjacências
+ * nunca são alteradas por duas threads. Com arena, cada thread usa a sua.
+ */
+static void ligarTarefaGrafo(void* contexto, int tarefa, int trabalhador) {
+    ContextoGrafo* ctx = (ContextoGrafo*)contexto;
+    TarefaGrafo* t = &ctx->tarefas[tarefa];
+    ArenaGrafo* arena = NULL;
+    if (ctx->usarArena) {
+        if (!ctx->arenas[trabalhador]) ctx->arenas[trabalhador] = criarArena();
+        arena = ctx->arenas[trabalhador];
+        if (!arena) {
+            ctx->erro[tarefa] = 1;
+            return;
+        }
+    }
+    for (int i = t->primeiro; i < t->ultimo; i++) {
+        if (ligarAoGrupo(ctx->grupos, t->inicioGrupo, t->fimGrupo, i, arena) < 0) {
+            ctx->erro[tarefa] = 1;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Cria as mesmas adjacências que CriarGrafoPorFrequencia usando várias threads.
+ *
+ * As frequências são independentes entre si, por isso cada grupo é dividido em tarefas
+ * com cerca de GRAFO_ARESTAS_POR_TAREFA adjacências (um grupo pequeno é uma tarefa; um grupo
+ * grande é dividido em várias). As tarefas são distribuídas com roubo de trabalho
+ * (executarTarefas). Com arena, cada thread cria as adjacências na sua própria arena, que
+ * no fim é junta à arena do grafo; sem arena é usado malloc. A ordem das adjacências de
+ * cada vértice é a mesma que em CriarGrafoPorFrequencia. Com arena, os vértices têm de
+ * ter sido criados nela (como em CriarGrafoPorFrequenciaArena).
+ *
+ * @param lista Apontador para o início da lista ligada de vértices (antenas).
+ * @param arena Arena dos vértices onde ficam as adjacências (NULL para usar malloc).
+ * @param numTrabalhadores Número de threads (0 ou negativo para usar todos os processadores).
+ * @return Apontador para o início da lista, com as adjacências preenchidas.
+ */
+Vertice* CriarGrafoParalelo(Vertice* lista, ArenaGrafo* arena, int numTrabalhadores) {
+    int trabalhadores = numeroTrabalhadores(numTrabalhadores);
+    if (lista == NULL || trabalhadores == 1) {
+        return CriarGrafoPorFrequenciaArena(lista, arena);
+    }
+    if (arena && !arenaContemLista(arena, lista)) {
+        printf("As antenas não pertencem à arena do grafo!\n");
+        return lista;
+    }
+    int inicio[257];
+    Vertice** grupos = agruparPorFrequencia(lista, inicio);
+    if (!grupos) {
+        return lista;
+    }
+    // Contar as tarefas: cada grupo é dividido em partes com cerca de GRAFO_ARESTAS_POR_TAREFA adjacências
+    int porTarefa[256];
+    int numTarefas = 0;
+    for (int f = 0; f < 256; f++) {
+        int m = inicio[f + 1] - inicio[f];
+        porTarefa[f] = m > 1 ? GRAFO_ARESTAS_POR_TAREFA / (m - 1) : 1;
+        if (porTarefa[f] < 1) porTarefa[f] = 1;
+        if (m > 1) numTarefas += (m + porTarefa[f] - 1) / porTarefa[f];
+    }
+    ContextoGrafo ctx;
+    ctx.grupos = grupos;
+    ctx.usarArena = arena != NULL;
+    ctx.tarefas = (TarefaGrafo*)malloc((size_t)(numTarefas > 0 ? numTarefas : 1) * sizeof(TarefaGrafo));
+    ctx.erro = (char*)calloc((size_t)(numTarefas > 0 ? numTarefas : 1), 1);
+    ctx.arenas = (ArenaGrafo**)calloc((size_t)trabalhadores, sizeof(ArenaGrafo*));
+    if (!ctx.tarefas || !ctx.erro || !ctx.arenas) {
+        printf("Erro ao alocar memória para as tarefas!\n");
+        free(ctx.tarefas); free(ctx.erro); free(ctx.arenas); free(grupos);
+        return lista;
+    }
+    int t = 0;
+    for (int f = 0; f < 256; f++) {
+        if (inicio[f + 1] - inicio[f] < 2) continue;
+        for (int i = inicio[f]; i < inicio[f + 1]; i += porTarefa[f], t++) {
+            ctx.tarefas[t].primeiro = i;
+            ctx.tarefas[t].ultimo = i + porTarefa[f] < inicio[f + 1] ? i + porTarefa[f] : inicio[f + 1];
+            ctx.tarefas[t].inicioGrupo = inicio[f];
+            ctx.tarefas[t].fimGrupo = inicio[f + 1];
+        }
+    }
+    int erro = executarTarefas(numTarefas, ligarTarefaGrafo, &ctx, trabalhadores) < 0;
+    for (t = 0; t < numTarefas; t++) {
+        erro = erro || ctx.erro[t];
+    }
+    // Juntar as arenas das threads à arena do grafo
+    for (int i = 0; i < trabalhadores; i++) {
+        if (ctx.arenas[i]) juntarArena(arena, ctx.arenas[i]);
+    }
+    if (erro) {
+        printf("Erro ao alocar memória para a adjacência!\n");
+    }
+    free(ctx.tarefas);
+    free(ctx.erro);
+    free(ctx.arenas);
+    free(grupos);
+    return lista;
+}
+#pragma endregion
 #pragma region Criar Antena
 /**
  * @brief Cria uma nova antena (vértice) com a frequência e as coordenadas.
@@ -66,9 +330,14 @@ Vertice* criarAntena(char frequencia, int x, int y) {
     nova->frequencia = frequencia;
     nova->x = x;
     nova->y = y;
+    nova->visitado = 0;
+    nova->id = -1;            // Só é numerada quando for preciso (numerarVertices)
+    nova->epoca = 0;          // Ainda não foi visitada por nenhuma pesquisa iterativa
+    nova->componente = -1;    // Só é calculada quando for preciso (calcularComponentes)
     // Apontadores da lista ligada
     nova->adjacencias = NULL; // Sem ligações ainda
     nova->prox = NULL;        // Não está ligada a nenhuma outra antena
+    nova->ant = NULL;
     // Retornar o apontador para a nova antena
     return nova;
 }
@@ -101,9 +370,11 @@ Vertice* InsereAntena(Vertice* novo, Vertice* head, int* res) {
         }
         aux = aux->prox;
     }
-    // Inserir no início da lista se for vazia ou se a nova antena vier antes
-    if (head == NULL || head->x > novo->x || (head->x == novo->x && head->y > novo->y)) {
+    // Inserir no início da lista se for vazia ou se a nova antena vier antes (ou na mesma posição)
+    if (head == NULL || head->x > novo->x || (head->x == novo->x && head->y >= novo->y)) {
         novo->prox = head;
+        novo->ant = NULL;
+        if (head) head->ant = novo;
         *res = 1; 
         return novo;
     }
@@ -116,11 +387,73 @@ Vertice* InsereAntena(Vertice* novo, Vertice* head, int* res) {
     }
     // Inserção entre anterior e aux
     anterior->prox = novo;
+    novo->ant = anterior;
     novo->prox = aux;
+    if (aux) aux->ant = novo;
     *res = 1; 
     return head;
 }
 #pragma endregion
+#pragma region Inserir Antena Indexada
+/**
+ * @brief Insere uma nova antena na lista ordenada usando o índice de coordenadas.
+ *
+ * Tem o mesmo comportamento que InsereAntena, mas a verificação de repetição consulta
+ * apenas a célula (x, y) no índice e o lugar na lista é encontrado a partir do último
+ * vértice da linha (antecessorIndice), sem percorrer a lista desde o início. Quando a
+ * antena fica no fim da sua linha (caso da leitura de um ficheiro, que está ordenado
+ * por linha e coluna) a inserção custa O(1), por isso carregar N antenas custa O(N).
+ * A lista só deve ser alterada pelas funções indexadas enquanto o índice estiver em uso.
+ * Se o índice tiver uma quadtree associada (ativarIndiceEspacial), a antena também é
+ * inserida nela, e se tiver um rastreador de efeitos (ativarRastreadorEfeitos) os
+ * efeitos nefastos da antena são registados.
+ *
+ * @param novo Apontador para a nova antena a ser inserida.
+ * @param head Cabeça da lista ligada de antenas.
+ * @param indice Índice de coordenadas da lista.
+ * @param res Apontador onde guarda o resultado (1 se inserido, 0 se não foi).
+ * @return Apontador para a nova cabeça da lista.
+ */
+Vertice* InsereAntenaIndexada(Vertice* novo, Vertice* head, IndiceAntenas* indice, int* res) {
+    *res = 0;
+    if (!novo) return head;
+    if (!indice) return InsereAntena(novo, head, res);
+    // Verificar as antenas que já estão nesta célula
+    if (procurarAntenaIndice(indice, novo->frequencia, novo->x, novo->y)) {
+        printf("Antena já existe nas coordenadas (%d, %d) com frequência %c!\n", novo->x, novo->y, novo->frequencia);
+        free(novo);
+        return head;
+    }
+    // Tal como em InsereAntena, fica antes das antenas da mesma célula
+    Vertice* anterior = antecessorIndice(indice, head, novo->x, novo->y);
+    novo->ant = anterior;
+    novo->prox = anterior ? anterior->prox : head;
+    if (novo->prox) novo->prox->ant = novo;
+    if (anterior) {
+        anterior->prox = novo;
+    } else {
+        head = novo;
+    }
+    if (!registarVerticeIndice(indice, novo)) {
+        // Sem memória para o índice: a antena sai outra vez da lista
+        printf("Erro ao atualizar o índice de antenas!\n");
+        if (novo->ant) {
+            novo->ant->prox = novo->prox;
+        } else {
+            head = novo->prox;
+        }
+        if (novo->prox) novo->prox->ant = novo->ant;
+        free(novo);
+        return head;
+    }
+    if (indice->espacial) inserirQuadtree(indice->espacial, novo);
+    if (indice->efeitos && registarAntenaEfeitos(indice->efeitos, indice, novo) < 0) {
+        printf("Erro ao atualizar os efeitos nefastos!\n");
+    }
+    *res = 1;
+    return head;
+}
+#pragma endregion
 #pragma region Remover Antena
 /**
  * @brief Remove uma antena da lista de antenas com base nas coordenadas (x, y).
@@ -145,6 +478,7 @@ Vertice* removeAntena(Vertice* head, int x, int y) {
                 // Se estiver no meio ou fim da lista
                 anterior->prox = atual->prox;
             }
+            if (atual->prox) atual->prox->ant = anterior;
             // Libertar as adjacências associadas à antena
             AdjD* adj = atual->adjacencias;
             while (adj) {
@@ -164,6 +498,46 @@ Vertice* removeAntena(Vertice* head, int x, int y) {
     return head;
 }
 #pragma endregion
+#pragma region Remover Antena Indexada
+/**
+ * @brief Remove uma antena com base nas coordenadas (x, y) usando o índice.
+ *
+ * Remove a mesma antena que removeAntena (a primeira da lista com essas coordenadas),
+ * mas encontra-a pelo índice e desliga-a através do apontador para o vértice anterior,
+ * sem percorrer a lista. A antena também sai da quadtree e do rastreador de efeitos
+ * associados ao índice, se houver.
+ *
+ * @param head Cabeça da lista de antenas.
+ * @param indice Índice de coordenadas da lista.
+ * @param x Coordenada x da antena a remover.
+ * @param y Coordenada y da antena a remover.
+ * @return Nova cabeça da lista após a remoção.
+ */
+Vertice* removeAntenaIndexada(Vertice* head, IndiceAntenas* indice, int x, int y) {
+    if (!indice) return removeAntena(head, x, y);
+    Vertice* atual = procurarIndice(indice, x, y);
+    if (!atual) return head;
+    // Atualizar o índice: a célula passa para a antena seguinte ou deixa de existir
+    retirarVerticeIndice(indice, atual);
+    if (indice->espacial) removerQuadtree(indice->espacial, atual);
+    if (indice->efeitos) retirarAntenaEfeitos(indice->efeitos, indice, atual);
+    if (atual->ant) {
+        atual->ant->prox = atual->prox;
+    } else {
+        head = atual->prox;
+    }
+    if (atual->prox) atual->prox->ant = atual->ant;
+    // Libertar as adjacências associadas à antena
+    AdjD* adj = atual->adjacencias;
+    while (adj) {
+        AdjD* temp = adj;
+        adj = adj->next;
+        free(temp);
+    }
+    free(atual);
+    return head;
+}
+#pragma endregion
 #pragma region Criar Adjacência
 /**
  * @brief Cria uma nova adjacência (ligação) para um vértice (antena).
@@ -260,12 +634,32 @@ int efeitoExiste(int efeitos[][2], int total, int x, int y) {
 }
 #pragma endregion
 #pragma region Calcular Efeito Nefasto
+/**
+ * @brief Imprime as posições de um conjunto de efeitos e liberta-o.
+ *
+ * @param efeitos Conjunto de efeitos (pode ser NULL em caso de erro).
+ * @return Número de efeitos impressos.
+ */
+static int imprimirEfeitos(ConjuntoEfeitos* efeitos) {
+    if (!efeitos) {
+        return 0;
+    }
+    TextoSaida texto = { 0 };
+    int total = formatarEfeitos(&texto, efeitos);
+    escreverTexto(&texto, stdout);
+    libertarTexto(&texto);
+    libertarConjuntoEfeitos(efeitos);
+    return total;
+}
+
 /**
  * @brief Calcula e imprime na consola os efeitos nefastos provocados por interferência de antenas.
  *
  * Um efeito nefasto ocorre quando duas antenas com a mesma frequência estão separadas
  * exatamente por 2 unidades, na vertical ou horizontal. A posição intermédia é onde o
  * efeito é registado.
+ * As posições são calculadas por calcularEfeitos (efeitos.c), que só compara antenas da
+ * mesma frequência e linha/coluna e não tem limite no número de efeitos.
  *
  * @param lista Lista ligada de antenas (vértices).
  * @return Número total de efeitos nefastos identificados.
@@ -274,49 +668,33 @@ int calcularEfeitosNefastos(Vertice* lista) {
     printf("\nEfeitos nefastos:\n");
     printf("Coordenadas (x, y)\n");
     printf("-------------------\n");
-    int total = 0;
-    int efeitos[100][2]; 
-    int totalEfeitos = 0;
-    // Percorrer todas as combinações de pares de antenas
-    for (Vertice* a = lista; a != NULL; a = a->prox) {
-        for (Vertice* b = a->prox; b != NULL; b = b->prox) {
-            if (a->frequencia == b->frequencia) {
-                if (a->x == b->x && abs(a->y - b->y) == 2) {
-                    int meioY = (a->y + b->y) / 2;
-                    if (!efeitoExiste(efeitos, totalEfeitos, a->x, meioY)) {
-                        printf("Vertical: (%d, %d)\n", a->x, meioY);
-                        efeitos[totalEfeitos][0] = a->x;
-                        efeitos[totalEfeitos][1] = meioY;
-                        totalEfeitos++;
-                        total++;
-                    }
-                }
-                // Verifica se estão alinhadas horizontalmente a 2 unidades de distância
-                else if (a->y == b->y && abs(a->x - b->x) == 2) {
-                    int meioX = (a->x + b->x) / 2;
-                    if (!efeitoExiste(efeitos, totalEfeitos, meioX, a->y)) {
-                        printf("Horizontal: (%d, %d)\n", meioX, a->y);
-                        efeitos[totalEfeitos][0] = meioX;
-                        efeitos[totalEfeitos][1] = a->y;
-                        totalEfeitos++;
-                        total++;
-                    }
-                }
-            }
-        }
-    }
-    if (total == 0) {
-        printf("Nenhum efeito nefasto encontrado.\n");
-    }
-    return total;
+    return imprimirEfeitos(calcularEfeitos(lista, EFEITO_DISTANCIA_2));
+}
+
+/**
+ * @brief Calcula e imprime os mesmos efeitos nefastos que calcularEfeitosNefastos usando várias threads.
+ *
+ * As posições são calculadas por calcularEfeitosParalelo (efeitos.c) e impressas pela
+ * mesma ordem que na versão sequencial.
+ *
+ * @param lista Lista ligada de antenas (vértices).
+ * @param numTrabalhadores Número de threads (0 ou negativo para usar todos os processadores).
+ * @return Número total de efeitos nefastos identificados.
+ */
+int calcularEfeitosNefastosParalelo(Vertice* lista, int numTrabalhadores) {
+    printf("\nEfeitos nefastos:\n");
+    printf("Coordenadas (x, y)\n");
+    printf("-------------------\n");
+    return imprimirEfeitos(calcularEfeitosParalelo(lista, EFEITO_DISTANCIA_2, numTrabalhadores));
 }
 #pragma endregion
 #pragma region Libertar Memória
 /**
  * @brief Liberta toda a memória alocada para a lista de antenas (vértices).
  *
- * Esta função percorre a lista ligada de antenas e liberta cada nó da memória.
- * Não liberta as listas de adjacências associadas a cada antena!
+ * Esta função percorre a lista ligada de antenas e liberta cada nó da memória,
+ * juntamente com a sua lista de adjacências.
+ * Os grafos criados numa arena são libertados com libertarArena.
  *
  * @param lista Apontador para o início da lista de vértices (antenas).
  * @return Número total de vértices (antenas) libertados da memória.
@@ -326,6 +704,13 @@ int libertarMemoria(Vertice *lista) {
     while (lista) {
         Vertice *temp = lista;
         lista = lista->prox;
+        // Liberta as adjacências do vértice atual
+        AdjD *adj = temp->adjacencias;
+        while (adj) {
+            AdjD *seguinte = adj->next;
+            free(adj);
+            adj = seguinte;
+        }
         free(temp);  // Liberta o vértice atual
         contador++;  // Conta quantos foram libertados
     }
@@ -337,22 +722,34 @@ int libertarMemoria(Vertice *lista) {
  * @brief Lista todas as antenas da estrutura ligada de vértices.
  *
  * Esta função percorre a lista ligada de antenas (vértices) e mostra no ecrã
- * a frequência e as coordenadas (x, y) de cada uma.
+ * a frequência e as coordenadas (x, y) de cada uma. O texto é formatado em memória
+ * (formatarAntenas) e escrito de uma só vez.
  *
  * @param lista Apontador para o início da lista de vértices (antenas).
  * @return Número total de antenas listadas.
  */
 int listarAntenas(Vertice *lista) {
+    TextoSaida texto = { 0 };
+    int contador = formatarAntenas(&texto, lista);
+    escreverTexto(&texto, stdout);
+    libertarTexto(&texto);
+    return contador;  
+}
+
+/**
+ * @brief Copia para um vetor os apontadores das antenas da lista, sem imprimir nada.
+ *
+ * @param lista Apontador para o início da lista de vértices (antenas).
+ * @param antenas Vetor a preencher (pode ser NULL se max for 0).
+ * @param max Número máximo de antenas a copiar.
+ * @return Número total de antenas da lista (pode ser maior do que max).
+ */
+int copiarAntenas(Vertice* lista, Vertice** antenas, int max) {
     int contador = 0;
-    printf("\nLista de Antenas:\n");
-    printf("Frequência | Coordenadas (x, y)\n");
-    printf("-------------------------------\n");
-    while (lista) { //desde que 
-        printf("    %c      |    (%d, %d)\n", lista->frequencia, lista->x, lista->y);
-        lista = lista->prox;  
-        contador++;        
+    for (Vertice* v = lista; v; v = v->prox, contador++) {
+        if (contador < max) antenas[contador] = v;
     }
-    return contador;  
+    return contador;
 }
 #pragma endregion
 #pragma region Carregar Antenas do Ficheiro
@@ -364,6 +761,8 @@ int listarAntenas(Vertice *lista) {
  * um novo vértice. 
  * 
  * Caracteres como '.' (ponto), ' ' (espaço) e '\n' são ignorados.
+ * As inserções usam um índice de coordenadas temporário, por isso o custo
+ * da leitura é linear no número de antenas.
  * 
  * @param nomeFicheiro Nome do ficheiro de texto a ler (ex: "antenas.txt")
  * @return Apontador para a lista ligada de vértices (antenas) carregadas
@@ -376,48 +775,37 @@ Vertice* carregarAntenasDeFicheiro(char *nomeFicheiro) {
     Vertice *lista = NULL;  
     int linha = 0, resultado;
     char linhaFicheiro[250]; // Buffer para guardar cada linha lida do ficheiro
+    // O índice evita percorrer a lista em cada inserção
+    IndiceAntenas *indice = criarIndice(0);
     while (fgets(linhaFicheiro, sizeof(linhaFicheiro), file)) {
         for (int coluna = 0; linhaFicheiro[coluna] != '\n' && linhaFicheiro[coluna] != '\0'; coluna++) {
             // Ignora os caracteres que não representam antenas
             if (linhaFicheiro[coluna] != '.' && linhaFicheiro[coluna] != '\n' && linhaFicheiro[coluna] != ' ') {
                 // Cria uma nova antena com frequência, linha e coluna (ajustadas para não começar em 0)
                 Vertice *nova = criarAntena(linhaFicheiro[coluna], linha + 1, coluna + 1);
-                lista = InsereAntena(nova, lista, &resultado);
+                lista = InsereAntenaIndexada(nova, lista, indice, &resultado);
             }
         }
         linha++; 
     }
+    libertarIndice(indice);
     fclose(file);  
     return lista;  
 }
 #pragma endregion
 #pragma region Guardar em ficheiro Binário
 /**
- * @brief Guarda a lista de antenas num ficheiro binário.
+ * @brief Guarda a lista de antenas e as suas adjacências num ficheiro binário.
  *
- * Esta função percorre a lista ligada de antenas e escreve cada vértice (antena)
- * no ficheiro binário "antenas.bin". 
+ * O grafo é escrito no ficheiro "antenas.bin" no formato descrito em snapshot.h
+ * (vértices numerados e arestas por número em vez de apontadores), que pode
+ * ser recarregado com carregarAntenasDeFicheiroBinario.
  *
  * @param lista Apontador para o início da lista de antenas.
  * @return int Retorna 0 em caso de sucesso ou -1 em caso de erro.
  */
 int guardarAntenasEmFicheiroBinario(Vertice *lista) {
-    FILE *file = fopen("antenas.bin", "wb");  
-    if (!file) {
-        return -1;
-    }
-    Vertice *aux = lista; // Apontador auxiliar para percorrer a lista
-    // Escreve cada vértice no ficheiro até ao fim da lista
-    while (aux) {
-        // fwrite escreve 1 estrutura Vertice do ponteiro aux no ficheiro
-        if (fwrite(aux, sizeof(Vertice), 1, file) != 1) {
-            fclose(file); 
-            return -1;
-        }
-        aux = aux->prox; 
-    }
-    fclose(file); 
-    return 0; 
+    return guardarGrafoBinario(lista, "antenas.bin");
 }
 #pragma endregion
 #pragma region Limpar
@@ -425,7 +813,8 @@ int guardarAntenasEmFicheiroBinario(Vertice *lista) {
  * @brief Marca todos os vértices da lista como não visitados.
  *
  * Esta função é chamada antes de executar uma DFS para garantir
- * que o estado "visitado" de cada vértice está limpo.
+ * que o estado "visitado" de cada vértice está limpo. Também apaga as
+ * marcas das pesquisas iterativas, que normalmente não precisam de limpeza.
  *
  * @param lista Apontador para o início da lista de vértices (antenas).
  */
@@ -433,11 +822,31 @@ int limparVisitados(Vertice* lista) {
     if (!lista) return 0;
     while (lista) {
         lista->visitado = 0;
+        lista->epoca = 0;
         lista = lista->prox;
     }
     return 1; 
 }
 #pragma endregion
+#pragma region Numerar
+/**
+ * @brief Atribui a cada vértice o seu número de ordem na lista (0, 1, 2, ...).
+ *
+ * O número fica no campo "id" e permite guardar informação sobre os vértices
+ * em vetores em vez de na própria estrutura.
+ *
+ * @param lista Apontador para o início da lista de vértices (antenas).
+ * @return Número de vértices numerados.
+ */
+int numerarVertices(Vertice* lista) {
+    int total = 0;
+    while (lista) {
+        lista->id = total++;
+        lista = lista->prox;
+    }
+    return total;
+}
+#pragma endregion
 #pragma region Profundidade
 /**
  * @brief Realiza uma busca em profundidade (DFS) a partir de uma antena.
@@ -460,6 +869,253 @@ int dfs(Vertice* atual) {
     return 1; 
 }
 #pragma endregion
+#pragma region Pesquisa Iterativa
+/**
+ * @brief Pilha (ou fila) de trabalho das pesquisas iterativas, guardada no heap.
+ */
+typedef struct pilhaPesquisa {
+    Vertice** vertices;          // Vértices empilhados
+    AdjD** seguinte;             // Próxima adjacência a explorar de cada vértice
+    int topo;                    // Número de elementos
+    int capacidade;
+} PilhaPesquisa;
+
+static unsigned int epocaPesquisa = 0;  // Época da última pesquisa iterativa
+
+/**
+ * @brief Começa uma nova pesquisa iterativa.
+ *
+ * Um vértice foi visitado na pesquisa atual quando o seu campo "epoca" é igual
+ * ao valor devolvido, por isso não é preciso limpar todos os vértices antes de
+ * cada pesquisa (limparVisitados só é necessário ao fim de 2^32 pesquisas).
+ *
+ * @return Época da nova pesquisa (nunca é 0).
+ */
+unsigned int novaEpocaPesquisa(void) {
+    epocaPesquisa++;
+    if (epocaPesquisa == 0) {
+        epocaPesquisa = 1;
+    }
+    return epocaPesquisa;
+}
+
+/**
+ * @brief Acrescenta um vértice à pilha, aumentando-a se for preciso.
+ *
+ * @param p Pilha de trabalho.
+ * @param v Vértice a acrescentar.
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int empilhar(PilhaPesquisa* p, Vertice* v) {
+    if (p->topo == p->capacidade) {
+        int capacidade = p->capacidade ? p->capacidade * 2 : 64;
+        Vertice** vertices = (Vertice**)realloc(p->vertices, capacidade * sizeof(Vertice*));
+        if (!vertices) return 0;
+        p->vertices = vertices;
+        AdjD** seguinte = (AdjD**)realloc(p->seguinte, capacidade * sizeof(AdjD*));
+        if (!seguinte) return 0;
+        p->seguinte = seguinte;
+        p->capacidade = capacidade;
+    }
+    p->vertices[p->topo] = v;
+    p->seguinte[p->topo] = v->adjacencias;
+    p->topo++;
+    return 1;
+}
+
+/**
+ * @brief Liberta a memória da pilha de trabalho.
+ *
+ * @param p Pilha de trabalho.
+ */
+static void libertarPilha(PilhaPesquisa* p) {
+    free(p->vertices);
+    free(p->seguinte);
+}
+
+/**
+ * @brief Percorre os vértices alcançáveis a partir de inicio em profundidade ou em largura.
+ *
+ * Em profundidade os vértices são visitados pela mesma ordem que a função dfs (cada
+ * vértice quando é descoberto, com as adjacências pela ordem da lista); em largura por
+ * ordem de distância ao vértice inicial. As visitas são marcadas com a época da pesquisa.
+ *
+ * @param inicio Vértice inicial.
+ * @param largura 1 para BFS, 0 para DFS.
+ * @param ordem Vetor onde ficam os primeiros max vértices visitados (pode ser NULL).
+ * @param max Tamanho do vetor ordem.
+ * @param texto Texto onde cada vértice visitado é formatado (NULL para não formatar).
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória.
+ */
+static int percorrer(Vertice* inicio, int largura, Vertice** ordem, int max, TextoSaida* texto) {
+    unsigned int epoca = novaEpocaPesquisa();
+    PilhaPesquisa pilha = { NULL, NULL, 0, 0 };
+    int total = 0;
+    inicio->epoca = epoca;
+    if (!empilhar(&pilha, inicio)) {
+        libertarPilha(&pilha);
+        return -1;
+    }
+    if (!largura) {
+        // A pilha guarda o caminho atual e a próxima adjacência de cada vértice
+        if (ordem && max > 0) ordem[0] = inicio;
+        if (texto) formatarVertice(texto, inicio);
+        total = 1;
+        while (pilha.topo > 0) {
+            AdjD* adj = pilha.seguinte[pilha.topo - 1];
+            if (!adj) {
+                pilha.topo--;  // Todas as adjacências deste vértice já foram vistas
+                continue;
+            }
+            pilha.seguinte[pilha.topo - 1] = adj->next;
+            Vertice* v = adj->destino;
+            if (v->epoca != epoca) {
+                v->epoca = epoca;
+                if (ordem && total < max) ordem[total] = v;
+                if (texto) formatarVertice(texto, v);
+                total++;
+                if (!empilhar(&pilha, v)) {
+                    libertarPilha(&pilha);
+                    return -1;
+                }
+            }
+        }
+    } else {
+        // A pilha funciona como fila: nada é retirado, "frente" avança
+        for (int frente = 0; frente < pilha.topo; frente++) {
+            Vertice* atual = pilha.vertices[frente];
+            if (ordem && frente < max) ordem[frente] = atual;
+            if (texto) formatarVertice(texto, atual);
+            for (AdjD* adj = atual->adjacencias; adj; adj = adj->next) {
+                Vertice* v = adj->destino;
+                if (v->epoca != epoca) {
+                    v->epoca = epoca;
+                    if (!empilhar(&pilha, v)) {
+                        libertarPilha(&pilha);
+                        return -1;
+                    }
+                }
+            }
+        }
+        total = pilha.topo;
+    }
+    libertarPilha(&pilha);
+    return total;
+}
+
+/**
+ * @brief Pesquisa em profundidade (DFS) iterativa a partir de uma antena.
+ *
+ * Visita e imprime as antenas pela mesma ordem que a função dfs, mas usa uma pilha
+ * no heap em vez da recursividade, por isso não esgota a pilha do programa em
+ * componentes muito grandes. Não usa nem altera o campo "visitado".
+ * O texto é formatado em memória e escrito de uma só vez no fim.
+ *
+ * @param inicio Apontador para o vértice inicial.
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória.
+ */
+int dfsIterativo(Vertice* inicio) {
+    if (!inicio) return 0;
+    TextoSaida texto = { 0 };
+    int total = percorrer(inicio, 0, NULL, 0, &texto);
+    escreverTexto(&texto, stdout);
+    libertarTexto(&texto);
+    return total;
+}
+
+/**
+ * @brief Pesquisa em largura (BFS) a partir de uma antena.
+ *
+ * Imprime as antenas por ordem de distância (número de ligações) ao vértice inicial.
+ * A fila é guardada no heap e as visitas são marcadas com a época da pesquisa.
+ *
+ * @param inicio Apontador para o vértice inicial.
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória.
+ */
+int bfsIterativo(Vertice* inicio) {
+    if (!inicio) return 0;
+    TextoSaida texto = { 0 };
+    int total = percorrer(inicio, 1, NULL, 0, &texto);
+    escreverTexto(&texto, stdout);
+    libertarTexto(&texto);
+    return total;
+}
+
+/**
+ * @brief DFS que devolve a ordem de visita num vetor em vez de a imprimir.
+ *
+ * A ordem é a mesma de dfs e dfsIterativo. Se max for menor do que o número de
+ * vértices alcançáveis, só os primeiros max ficam no vetor.
+ *
+ * @param inicio Apontador para o vértice inicial.
+ * @param ordem Vetor a preencher com os vértices pela ordem de visita.
+ * @param max Tamanho do vetor.
+ * @return Número de vértices visitados (pode ser maior do que max), ou -1 em caso de erro de memória.
+ */
+int dfsOrdem(Vertice* inicio, Vertice** ordem, int max) {
+    if (!inicio) return 0;
+    return percorrer(inicio, 0, ordem, max, NULL);
+}
+
+/**
+ * @brief BFS que devolve a ordem de visita num vetor em vez de a imprimir.
+ *
+ * @param inicio Apontador para o vértice inicial.
+ * @param ordem Vetor a preencher com os vértices por ordem de distância.
+ * @param max Tamanho do vetor.
+ * @return Número de vértices visitados (pode ser maior do que max), ou -1 em caso de erro de memória.
+ */
+int bfsOrdem(Vertice* inicio, Vertice** ordem, int max) {
+    if (!inicio) return 0;
+    return percorrer(inicio, 1, ordem, max, NULL);
+}
+
+/**
+ * @brief Encontra e imprime todos os caminhos entre duas antenas sem recursividade.
+ *
+ * Faz o mesmo percurso que encontrarCaminhos: a pilha guarda o caminho atual e,
+ * para cada vértice, a próxima adjacência a explorar. Um vértice está no caminho
+ * atual quando a sua época é a da pesquisa; ao sair do caminho a marca é apagada.
+ *
+ * @param origem Apontador para o vértice de partida.
+ * @param destino Apontador para o vértice de destino.
+ * @return Número de caminhos encontrados, ou -1 em caso de erro de memória.
+ */
+int encontrarCaminhosIterativo(Vertice* origem, Vertice* destino) {
+    if (!origem || !destino) return 0;
+    unsigned int epoca = novaEpocaPesquisa();
+    PilhaPesquisa pilha = { NULL, NULL, 0, 0 };
+    int total = 0;
+    origem->epoca = epoca;
+    if (!empilhar(&pilha, origem)) {
+        libertarPilha(&pilha);
+        return -1;
+    }
+    while (pilha.topo > 0) {
+        Vertice* atual = pilha.vertices[pilha.topo - 1];
+        if (atual == destino) {
+            imprimirCaminho(pilha.vertices, pilha.topo);
+            total++;
+        }
+        AdjD* adj = pilha.seguinte[pilha.topo - 1];
+        if (atual == destino || !adj) {
+            atual->epoca = 0;  // Sai do caminho atual
+            pilha.topo--;
+            continue;
+        }
+        pilha.seguinte[pilha.topo - 1] = adj->next;
+        if (adj->destino->epoca != epoca) {
+            adj->destino->epoca = epoca;
+            if (!empilhar(&pilha, adj->destino)) {
+                libertarPilha(&pilha);
+                return -1;
+            }
+        }
+    }
+    libertarPilha(&pilha);
+    return total;
+}
+#pragma endregion
 #pragma region Encontrar Caminhos
 /**
  * @brief Encontra e imprime todos os caminhos possíveis entre duas antenas.
@@ -471,23 +1127,27 @@ int dfs(Vertice* atual) {
  * @param destino Apontador para o vértice de destino.
  * @param caminho Array de apontadores que guarda o caminho atual.
  * @param pos     Posição atual no array do caminho (uso DFS - Profundidade).
+ * @return Número de caminhos encontrados a partir deste vértice.
+ *         Para contar sem imprimir, ou com limites, usar procurarCaminhos (caminhos.h).
  */
 int encontrarCaminhos(Vertice* atual, Vertice* destino, Vertice* caminho[], int pos) {
     if (!atual || atual->visitado) return 0; 
+    int total = 0;
     atual->visitado = 1;
     caminho[pos] = atual;
     pos++;
     if (atual == destino) {
         imprimirCaminho(caminho, pos); 
+        total = 1;
     } else {
         AdjD* adj = atual->adjacencias;
         while (adj) {
-            encontrarCaminhos(adj->destino, destino, caminho, pos); 
+            total += encontrarCaminhos(adj->destino, destino, caminho, pos); 
             adj = adj->next;
         }
     }
     atual->visitado = 0; 
-    return 1; 
+    return total; 
 }
 #pragma endregion
 #pragma region Imprimir Caminho
@@ -498,41 +1158,36 @@ int encontrarCaminhos(Vertice* atual, Vertice* destino, Vertice* caminho[], int
  * @param tamanho Número de vértices no caminho.
  */
 int imprimirCaminho(Vertice* caminho[], int tamanho) {
-    if (!caminho || tamanho <= 0) return 0; 
-    for (int i = 0; i < tamanho; i++) {
-        if (!caminho[i]) return 0; 
-        printf("(%d, %d)", caminho[i]->x, caminho[i]->y);
-        if (i < tamanho - 1) printf(" -> ");
-    }
-    printf("\n");
-    return 1; 
+    TextoSaida texto = { 0 };
+    int erro = formatarCaminho(&texto, caminho, tamanho) < 0;
+    if (!erro) escreverTexto(&texto, stdout);
+    libertarTexto(&texto);
+    return erro ? 0 : 1; 
 }
 #pragma endregion
 #pragma region Listar Interseções
 /**
  * @brief Lista interseções entre antenas de frequências distintas.
  *
- * Percorre a lista de vértices (antenas) e identifica posições (coordenadas)
- * onde existem duas antenas com frequências diferentes na mesma
- * posição (x, y).
+ * Identifica as posições (coordenadas) onde existem antenas das duas frequências.
+ * As posições são calculadas por calcularIntersecoes (intersecoes.c), que interseta os
+ * vetores ordenados das duas frequências em tempo linear em vez de comparar todos os
+ * pares, e são impressas por ordem de (x, y).
  *
  * @param lista Apontador para o início da lista ligada de vértices (antenas).
  * @param f1 Caractere que representa a primeira frequência a ser comparada.
  * @param f2 Caractere que representa a segunda frequência a ser comparada.
+ * @return Número de interseções encontradas, ou -1 em caso de erro de memória.
  */
 int listarIntersecoes(Vertice* lista, char f1, char f2) {
     if (!lista) return 0; 
     printf("Interseções entre antenas %c e %c:\n", f1, f2);
-    int encontrou = 0;
-    for (Vertice* aux1 = lista; aux1 != NULL; aux1 = aux1->prox) {
-        for (Vertice* aux2 = aux1->prox; aux2 != NULL; aux2 = aux2->prox) {
-            if (((aux1->frequencia == f1 && aux2->frequencia == f2) ||
-                 (aux1->frequencia == f2 && aux2->frequencia == f1)) &&
-                aux1->x == aux2->x && aux1->y == aux2->y) {
-                printf("Interseção em (%d, %d)\n", aux1->x, aux1->y);
-                encontrou = 1;
-            }
-        }
-    }
-    return 1; 
+    ResultadoIntersecoes* r = calcularIntersecoes(lista, f1, f2);
+    if (!r) return -1;
+    TextoSaida texto = { 0 };
+    int total = formatarIntersecoes(&texto, r);
+    escreverTexto(&texto, stdout);
+    libertarTexto(&texto);
+    libertarIntersecoes(r);
+    return total; 
 }
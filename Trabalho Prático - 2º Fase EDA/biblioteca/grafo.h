@@ -27,10 +27,24 @@ typedef struct vertice {
     char frequencia;             
     int x, y;                     
     int visitado;                
+    int id;                      // Número de ordem na lista (atribuído por numerarVertices)
+    unsigned int epoca;          // Marca da última pesquisa iterativa que visitou o vértice
+    int componente;              // Componente ligada (atribuída por calcularComponentes)
     struct vertice* prox;        // Apontador para o próximo vértice na lista ligada
+    struct vertice* ant;         // Apontador para o vértice anterior (remoção em O(1))
     AdjD* adjacencias;           // Lista ligada de adjacências 
 } Vertice;
 
+/**
+ * @brief Índice de coordenadas das antenas (definido em indice.h)
+ */
+typedef struct indiceAntenas IndiceAntenas;
+
+/**
+ * @brief Arena de memória dos vértices e adjacências (definida em memoria.h)
+ */
+typedef struct arenaGrafo ArenaGrafo;
+
 /**
  * @brief Inicializa a lista de vértices (grafo)
  * @param lista Apontador para a lista de vértices
@@ -38,6 +52,30 @@ typedef struct vertice {
  */
 Vertice* CriarGrafo(Vertice* lista);
 
+/**
+ * @brief Cria as adjacências agrupando primeiro as antenas por frequência
+ * @param lista Apontador para a lista de vértices
+ * @return Apontador para o início da lista
+ */
+Vertice* CriarGrafoPorFrequencia(Vertice* lista);
+
+/**
+ * @brief Cria as adjacências por frequência reservando-as numa arena
+ * @param lista Apontador para a lista de vértices (criados na arena, se houver arena)
+ * @param arena Arena onde são criadas as adjacências (NULL para usar malloc)
+ * @return Apontador para o início da lista
+ */
+Vertice* CriarGrafoPorFrequenciaArena(Vertice* lista, ArenaGrafo* arena);
+
+/**
+ * @brief Cria as adjacências por frequência dividindo o trabalho por várias threads
+ * @param lista Apontador para a lista de vértices (criados na arena, se houver arena)
+ * @param arena Arena onde são criadas as adjacências (NULL para usar malloc)
+ * @param numTrabalhadores Número de threads (0 para usar todos os processadores)
+ * @return Apontador para o início da lista
+ */
+Vertice* CriarGrafoParalelo(Vertice* lista, ArenaGrafo* arena, int numTrabalhadores);
+
 /**
  * @brief Cria uma nova antena (vértice)
  * @param frequencia Frequência da antena
@@ -56,6 +94,16 @@ Vertice* criarAntena(char frequencia, int x, int y);
  */
 Vertice* InsereAntena(Vertice* novo, Vertice* head, int* res);
 
+/**
+ * @brief Insere uma antena na lista de vértices usando o índice de coordenadas
+ * @param novo Nova antena a inserir
+ * @param head Cabeça da lista de vértices
+ * @param indice Índice de coordenadas mantido em conjunto com a lista
+ * @param res Apontador para código de resultado (1 = inserido, 0 = já existe)
+ * @return Nova cabeça da lista de vértices
+ */
+Vertice* InsereAntenaIndexada(Vertice* novo, Vertice* head, IndiceAntenas* indice, int* res);
+
 /**
  * @brief Remove uma antena da lista de vértices com base nas coordenadas
  * @param head Cabeça da lista de vértices
@@ -65,6 +113,16 @@ Vertice* InsereAntena(Vertice* novo, Vertice* head, int* res);
  */
 Vertice* removeAntena(Vertice* head, int x, int y);
 
+/**
+ * @brief Remove uma antena usando o índice de coordenadas
+ * @param head Cabeça da lista de vértices
+ * @param indice Índice de coordenadas mantido em conjunto com a lista
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Nova cabeça da lista
+ */
+Vertice* removeAntenaIndexada(Vertice* head, IndiceAntenas* indice, int x, int y);
+
 /**
  * @brief Cria uma adjacência entre antenas
  * @param destino Apontador para o vértice de destino
@@ -106,9 +164,17 @@ int efeitoExiste(int efeitos[][2], int total, int x, int y);
 int calcularEfeitosNefastos(Vertice* lista);
 
 /**
- * @brief Liberta a memória associada à lista de vértices e adjacências
+ * @brief Calcula e imprime os efeitos nefastos usando várias threads
  * @param lista Lista de antenas
- * @return 0 em caso de sucesso
+ * @param numTrabalhadores Número de threads (0 para usar todos os processadores)
+ * @return Número total de efeitos nefastos
+ */
+int calcularEfeitosNefastosParalelo(Vertice* lista, int numTrabalhadores);
+
+/**
+ * @brief Liberta a memória associada à lista de vértices e adjacências
+ * @param lista Lista de antenas (não pode ter sido criada numa arena)
+ * @return Número de vértices libertados
  */
 int libertarMemoria(Vertice *lista);
 
@@ -119,6 +185,15 @@ int libertarMemoria(Vertice *lista);
  */
 int listarAntenas(Vertice *lista);
 
+/**
+ * @brief Copia as antenas da lista para um vetor (sem imprimir)
+ * @param lista Lista de antenas
+ * @param antenas Vetor a preencher
+ * @param max Tamanho do vetor
+ * @return Número total de antenas da lista
+ */
+int copiarAntenas(Vertice* lista, Vertice** antenas, int max);
+
 /**
  * @brief Carrega antenas e ligações a partir de um ficheiro de texto
  * @param nomeFicheiro Nome do ficheiro a ler que será "antenas.txt"
@@ -127,9 +202,9 @@ int listarAntenas(Vertice *lista);
 Vertice* carregarAntenasDeFicheiro(char *nomeFicheiro);
 
 /**
- * @brief Guarda a estrutura do grafo num ficheiro binário
+ * @brief Guarda a estrutura do grafo no ficheiro binário "antenas.bin" (ver snapshot.h)
  * @param lista Lista de antenas
- * @return 0 em caso de sucesso
+ * @return 0 em caso de sucesso, -1 em caso de erro
  */
 int guardarAntenasEmFicheiroBinario(Vertice *lista);
 
@@ -140,6 +215,19 @@ int guardarAntenasEmFicheiroBinario(Vertice *lista);
  */
 int limparVisitados(Vertice* lista);
 
+/**
+ * @brief Numera os vértices pela ordem da lista (campo id)
+ * @param lista Lista de antenas
+ * @return Número de vértices numerados
+ */
+int numerarVertices(Vertice* lista);
+
+/**
+ * @brief Começa uma nova pesquisa iterativa (marca de visita no campo "epoca")
+ * @return Época da nova pesquisa (nunca é 0)
+ */
+unsigned int novaEpocaPesquisa(void);
+
 /**
  * @brief Algoritmo DFS (Depth-First Search)  a partir de um vértice
  * @param atual Vértice inicial da pesquisa
@@ -147,6 +235,46 @@ int limparVisitados(Vertice* lista);
  */
 int dfs(Vertice* atual);
 
+/**
+ * @brief DFS iterativa (pilha explícita) a partir de um vértice
+ * @param inicio Vértice inicial da pesquisa
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória
+ */
+int dfsIterativo(Vertice* inicio);
+
+/**
+ * @brief BFS (Breadth-First Search) iterativa a partir de um vértice
+ * @param inicio Vértice inicial da pesquisa
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória
+ */
+int bfsIterativo(Vertice* inicio);
+
+/**
+ * @brief DFS que guarda a ordem de visita num vetor (sem imprimir)
+ * @param inicio Vértice inicial da pesquisa
+ * @param ordem Vetor a preencher
+ * @param max Tamanho do vetor
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória
+ */
+int dfsOrdem(Vertice* inicio, Vertice** ordem, int max);
+
+/**
+ * @brief BFS que guarda a ordem de visita num vetor (sem imprimir)
+ * @param inicio Vértice inicial da pesquisa
+ * @param ordem Vetor a preencher
+ * @param max Tamanho do vetor
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória
+ */
+int bfsOrdem(Vertice* inicio, Vertice** ordem, int max);
+
+/**
+ * @brief Encontra e imprime os caminhos entre dois vértices sem recursividade
+ * @param origem Vértice de partida
+ * @param destino Vértice de destino
+ * @return Número de caminhos encontrados, ou -1 em caso de erro de memória
+ */
+int encontrarCaminhosIterativo(Vertice* origem, Vertice* destino);
+
 /**
  * @brief Encontra caminhos entre dois vértices e armazena em vetor
  * @param atual Vértice atual da pesquisa
@@ -170,7 +298,7 @@ int imprimirCaminho(Vertice* caminho[], int tamanho);
  * @param lista Lista de antenas
  * @param f1 Primeira frequência
  * @param f2 Segunda frequência
- * @return Número de interseções encontradas
+ * @return Número de interseções encontradas, ou -1 em caso de erro
  */
 int listarIntersecoes(Vertice* lista, char f1, char f2);
 #endif
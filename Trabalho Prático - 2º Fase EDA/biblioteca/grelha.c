@@ -0,0 +1,294 @@
+/**
+ * @file grelha.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da grelha densa com planos de bits por frequência
+ * @version 0.1
+ * @date 2025-06-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "grelha.h"
+#include "memoria.h"
+
+#pragma region Limites do Mapa
+/**
+ * @brief Calcula o retângulo ocupado pelas antenas e as frequências usadas.
+ *
+ * @return Número de antenas.
+ */
+static int limitesMapa(Vertice* lista, int* minX, int* minY, int* maxX, int* maxY, int* numFrequencias) {
+    int n = 0;
+    char usada[256] = { 0 };
+    *numFrequencias = 0;
+    for (Vertice* v = lista; v; v = v->prox, n++) {
+        if (n == 0 || v->x < *minX) *minX = v->x;
+        if (n == 0 || v->x > *maxX) *maxX = v->x;
+        if (n == 0 || v->y < *minY) *minY = v->y;
+        if (n == 0 || v->y > *maxY) *maxY = v->y;
+        if (!usada[(unsigned char)v->frequencia]) {
+            usada[(unsigned char)v->frequencia] = 1;
+            (*numFrequencias)++;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Verifica se a grelha ocupa menos memória do que a lista de vértices.
+ *
+ * A grelha gasta 1 byte por célula mais 1 bit por célula e frequência; a lista gasta
+ * um Vertice por antena. Para mapas densos (como antenas.txt) a grelha é muito mais
+ * pequena e o cálculo dos efeitos passa a ser feito com operações sobre palavras.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @return 1 se a grelha compensar, 0 caso contrário.
+ */
+int grelhaCompensa(Vertice* lista) {
+    int minX = 0, minY = 0, maxX = 0, maxY = 0, numFrequencias;
+    int n = limitesMapa(lista, &minX, &minY, &maxX, &maxY, &numFrequencias);
+    if (n == 0) return 0;
+    long long area = ((long long)maxX - minX + 1) * ((long long)maxY - minY + 1);
+    if (area > GRELHA_MAXIMO_CELULAS) return 0;
+    long long bytesGrelha = area + area * numFrequencias / 8;
+    return bytesGrelha < (long long)n * (long long)sizeof(Vertice);
+}
+#pragma endregion
+#pragma region Criar e Converter
+/**
+ * @brief Devolve o início da linha de um plano.
+ */
+static uint64_t* linhaPlano(GrelhaAntenas* g, int plano, int linha) {
+    return g->bits + ((size_t)plano * g->linhas + linha) * g->palavrasLinha;
+}
+
+/**
+ * @brief Cria a grelha densa com as antenas de uma lista.
+ *
+ * A grelha cobre só o retângulo ocupado pelas antenas. Cada frequência recebe um plano
+ * de bits pela ordem em que aparece na lista. Antenas repetidas (mesma frequência e
+ * posição) ficam só uma vez.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @return Grelha criada (libertar com libertarGrelha), ou NULL em caso de erro ou se
+ * o mapa tiver mais de GRELHA_MAXIMO_CELULAS células.
+ */
+GrelhaAntenas* criarGrelha(Vertice* lista) {
+    int minX = 0, minY = 0, maxX = 0, maxY = 0, numFrequencias;
+    int n = limitesMapa(lista, &minX, &minY, &maxX, &maxY, &numFrequencias);
+    long long linhas = n > 0 ? (long long)maxX - minX + 1 : 0;
+    long long colunas = n > 0 ? (long long)maxY - minY + 1 : 0;
+    if (linhas * colunas > GRELHA_MAXIMO_CELULAS) {
+        printf("Mapa demasiado grande para a grelha!\n");
+        return NULL;
+    }
+    GrelhaAntenas* g = (GrelhaAntenas*)calloc(1, sizeof(GrelhaAntenas));
+    if (!g) {
+        printf("Erro ao alocar memória para a grelha!\n");
+        return NULL;
+    }
+    g->x0 = minX;
+    g->y0 = minY;
+    g->linhas = (int)linhas;
+    g->colunas = (int)colunas;
+    g->palavrasLinha = (int)((colunas + 63) / 64);
+    for (int f = 0; f < 256; f++) g->plano[f] = -1;
+    size_t celulas = (size_t)(linhas * colunas);
+    g->celulas = (uint8_t*)calloc(celulas > 0 ? celulas : 1, 1);
+    g->bits = (uint64_t*)calloc((size_t)numFrequencias * (size_t)linhas * g->palavrasLinha + 1, sizeof(uint64_t));
+    if (!g->celulas || !g->bits) {
+        printf("Erro ao alocar memória para a grelha!\n");
+        libertarGrelha(g);
+        return NULL;
+    }
+    for (Vertice* v = lista; v; v = v->prox) {
+        unsigned char f = (unsigned char)v->frequencia;
+        if (g->plano[f] < 0) {
+            g->frequenciaPlano[g->numPlanos] = v->frequencia;
+            g->plano[f] = g->numPlanos++;
+        }
+        int linha = v->x - g->x0, coluna = v->y - g->y0;
+        uint64_t* palavra = linhaPlano(g, g->plano[f], linha) + coluna / 64;
+        uint64_t bit = 1ULL << (coluna % 64);
+        if (*palavra & bit) continue;    // Antena repetida
+        *palavra |= bit;
+        g->numAntenas++;
+        uint8_t* celula = &g->celulas[(size_t)linha * g->colunas + coluna];
+        if (*celula) {
+            g->partilhadas++;
+        } else {
+            *celula = f;
+        }
+    }
+    return g;
+}
+
+/**
+ * @brief Cria a lista de antenas de uma grelha, ordenada por (x, y).
+ *
+ * As antenas são ligadas no fim da lista pela ordem das células, como em
+ * carregarAntenasMapeado. Numa célula com várias frequências ficam pela ordem dos planos.
+ *
+ * @param g Grelha.
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc).
+ * @return Apontador para a lista, ou NULL se a grelha estiver vazia ou em caso de erro.
+ */
+Vertice* grelhaParaLista(GrelhaAntenas* g, ArenaGrafo* arena) {
+    if (!g) return NULL;
+    Vertice* lista = NULL;
+    Vertice* cauda = NULL;
+    for (int linha = 0; linha < g->linhas; linha++) {
+        const uint8_t* celulas = g->celulas + (size_t)linha * g->colunas;
+        for (int coluna = 0; coluna < g->colunas; coluna++) {
+            if (!celulas[coluna]) continue;
+            for (int p = 0; p < g->numPlanos; p++) {
+                // Sem células partilhadas basta a frequência guardada na célula
+                if (g->partilhadas == 0 && p != g->plano[celulas[coluna]]) continue;
+                if (!((linhaPlano(g, p, linha)[coluna / 64] >> (coluna % 64)) & 1)) continue;
+                Vertice* nova = criarAntenaArena(arena, g->frequenciaPlano[p], g->x0 + linha, g->y0 + coluna);
+                if (!nova) {
+                    printf("Erro ao alocar memória para as antenas!\n");
+                    if (!arena) libertarMemoria(lista);
+                    return NULL;
+                }
+                nova->ant = cauda;
+                if (cauda) {
+                    cauda->prox = nova;
+                } else {
+                    lista = nova;
+                }
+                cauda = nova;
+            }
+        }
+    }
+    return lista;
+}
+
+/**
+ * @brief Verifica se existe uma antena da frequência indicada em (x, y).
+ *
+ * @param g Grelha.
+ * @param frequencia Frequência da antena.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return 1 se existir, 0 caso contrário.
+ */
+int temAntenaGrelha(GrelhaAntenas* g, char frequencia, int x, int y) {
+    if (!g) return 0;
+    int p = g->plano[(unsigned char)frequencia];
+    long long linha = (long long)x - g->x0, coluna = (long long)y - g->y0;
+    if (p < 0 || linha < 0 || linha >= g->linhas || coluna < 0 || coluna >= g->colunas) return 0;
+    return (int)((linhaPlano(g, p, (int)linha)[coluna / 64] >> (coluna % 64)) & 1);
+}
+
+/**
+ * @brief Liberta a memória da grelha.
+ *
+ * @param g Grelha.
+ * @return 0 em caso de sucesso.
+ */
+int libertarGrelha(GrelhaAntenas* g) {
+    if (!g) return 0;
+    free(g->celulas);
+    free(g->bits);
+    free(g);
+    return 0;
+}
+#pragma endregion
+#pragma region Efeitos na Grelha
+/**
+ * @brief Calcula os efeitos nefastos com deslocamentos e ANDs sobre os planos de bits.
+ *
+ * Para cada frequência e linha R do plano (1 bit por coluna):
+ * - mesmo X (vertical): a coluna c é afetada se c - 1 e c + 1 tiverem antena, ou seja,
+ *   (R << 1) & (R >> 1), com os bits que passam de uma palavra para a seguinte;
+ * - mesmo Y (horizontal): a linha x é afetada onde as linhas x - 1 e x + 1 têm antena,
+ *   ou seja, R(x - 1) & R(x + 1), palavra a palavra.
+ * Os ciclos interiores só usam operações sobre palavras de 64 bits, por isso o
+ * compilador pode vetorizá-los. Cada palavra trata 64 células de uma vez.
+ *
+ * @param g Grelha.
+ * @return Conjunto com as mesmas posições que calcularEfeitos(lista, EFEITO_DISTANCIA_2),
+ * ordenadas por (x, y) ("Horizontal" quando a posição é originada nas duas direções),
+ * ou NULL em caso de erro.
+ */
+ConjuntoEfeitos* calcularEfeitosGrelha(GrelhaAntenas* g) {
+    if (!g) return NULL;
+    int w = g->palavrasLinha;
+    size_t palavras = (size_t)g->linhas * w;
+    uint64_t* verticais = (uint64_t*)calloc(palavras + 1, sizeof(uint64_t));
+    uint64_t* horizontais = (uint64_t*)calloc(palavras + 1, sizeof(uint64_t));
+    ConjuntoEfeitos* c = criarConjuntoEfeitos(0);
+    if (!verticais || !horizontais || !c) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        free(verticais);
+        free(horizontais);
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    for (int p = 0; p < g->numPlanos; p++) {
+        for (int linha = 0; linha < g->linhas; linha++) {
+            const uint64_t* r = linhaPlano(g, p, linha);
+            uint64_t* v = verticais + (size_t)linha * w;
+            for (int i = 0; i < w; i++) {
+                uint64_t esquerda = (r[i] << 1) | (i > 0 ? r[i - 1] >> 63 : 0);
+                uint64_t direita = (r[i] >> 1) | (i + 1 < w ? r[i + 1] << 63 : 0);
+                v[i] |= esquerda & direita;
+            }
+            if (linha == 0 || linha + 1 >= g->linhas) continue;
+            const uint64_t* acima = linhaPlano(g, p, linha - 1);
+            const uint64_t* abaixo = linhaPlano(g, p, linha + 1);
+            uint64_t* h = horizontais + (size_t)linha * w;
+            for (int i = 0; i < w; i++) {
+                h[i] |= acima[i] & abaixo[i];
+            }
+        }
+    }
+    int erro = 0;
+    for (int linha = 0; linha < g->linhas && !erro; linha++) {
+        for (int i = 0; i < w && !erro; i++) {
+            size_t k = (size_t)linha * w + i;
+            uint64_t todos = verticais[k] | horizontais[k];
+            while (todos && !erro) {
+                int b = __builtin_ctzll(todos);
+                char direcao = (horizontais[k] >> b) & 1 ? DIRECAO_MESMO_Y : DIRECAO_MESMO_X;
+                erro = adicionarEfeito(c, g->x0 + linha, g->y0 + i * 64 + b, direcao) < 0;
+                todos &= todos - 1;
+            }
+        }
+    }
+    free(verticais);
+    free(horizontais);
+    if (erro) {
+        printf("Erro ao alocar memória para os efeitos!\n");
+        libertarConjuntoEfeitos(c);
+        return NULL;
+    }
+    return c;
+}
+
+/**
+ * @brief Calcula os efeitos nefastos escolhendo a representação pela densidade do mapa.
+ *
+ * Se a grelha ocupar menos memória do que a lista (grelhaCompensa), os efeitos são
+ * calculados sobre os planos de bits; caso contrário é usado calcularEfeitos. As posições
+ * são as mesmas nos dois casos (a ordem pode ser diferente).
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @return Conjunto com as posições afetadas, ou NULL em caso de erro.
+ */
+ConjuntoEfeitos* calcularEfeitosAutomatico(Vertice* lista) {
+    if (grelhaCompensa(lista)) {
+        GrelhaAntenas* g = criarGrelha(lista);
+        if (g) {
+            ConjuntoEfeitos* c = calcularEfeitosGrelha(g);
+            libertarGrelha(g);
+            return c;
+        }
+    }
+    return calcularEfeitos(lista, EFEITO_DISTANCIA_2);
+}
+#pragma endregion
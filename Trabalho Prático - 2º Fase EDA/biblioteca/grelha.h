@@ -0,0 +1,94 @@
+/**
+ * @file grelha.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Representação do mapa numa grelha densa com um plano de bits por frequência
+ * @version 0.1
+ * @date 2025-06-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef GRELHA_H
+#define GRELHA_H
+
+#include <stdint.h>
+#include "grafo.h"
+#include "efeitos.h"
+
+#define GRELHA_MAXIMO_CELULAS (1LL << 28)   // Maior grelha aceite (linhas x colunas)
+
+/**
+ * @brief Mapa de antenas numa grelha densa.
+ *
+ * A célula (x, y) do mapa fica na linha x - x0 e coluna y - y0. Cada frequência tem um
+ * plano de bits (1 bit por célula, linhas de "palavrasLinha" palavras de 64 bits) e o
+ * vetor "celulas" guarda o caracter da frequência de cada célula (0 se estiver vazia).
+ */
+typedef struct grelhaAntenas {
+    int x0, y0;                  // Coordenadas da célula (0, 0)
+    int linhas, colunas;
+    int palavrasLinha;           // Palavras de 64 bits por linha de um plano
+    uint8_t* celulas;            // Frequência de cada célula (a primeira, se houver várias)
+    int partilhadas;             // Células com mais de uma frequência
+    int numPlanos;
+    int plano[256];              // Plano de cada frequência (-1 se não existir)
+    char frequenciaPlano[256];   // Frequência de cada plano
+    uint64_t* bits;              // numPlanos x linhas x palavrasLinha
+    int numAntenas;
+} GrelhaAntenas;
+
+/**
+ * @brief Verifica se compensa usar a grelha em vez da lista (ocupa menos memória)
+ * @param lista Lista de antenas
+ * @return 1 se a grelha ocupar menos memória do que os vértices, 0 caso contrário
+ */
+int grelhaCompensa(Vertice* lista);
+
+/**
+ * @brief Cria a grelha com as antenas de uma lista
+ * @param lista Lista de antenas
+ * @return Grelha criada, ou NULL em caso de erro (ou se o mapa for demasiado grande)
+ */
+GrelhaAntenas* criarGrelha(Vertice* lista);
+
+/**
+ * @brief Cria a lista de antenas (ordenada por x, y) de uma grelha
+ * @param g Grelha
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc)
+ * @return Lista de antenas, ou NULL se a grelha estiver vazia ou em caso de erro
+ */
+Vertice* grelhaParaLista(GrelhaAntenas* g, ArenaGrafo* arena);
+
+/**
+ * @brief Verifica se existe uma antena com a frequência nas coordenadas indicadas
+ * @param g Grelha
+ * @param frequencia Frequência da antena
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return 1 se existir, 0 caso contrário
+ */
+int temAntenaGrelha(GrelhaAntenas* g, char frequencia, int x, int y);
+
+/**
+ * @brief Calcula os efeitos nefastos (regra EFEITO_DISTANCIA_2) com operações sobre os planos de bits
+ * @param g Grelha
+ * @return Conjunto com as posições afetadas, ordenadas por (x, y), ou NULL em caso de erro
+ */
+ConjuntoEfeitos* calcularEfeitosGrelha(GrelhaAntenas* g);
+
+/**
+ * @brief Calcula os efeitos nefastos com a grelha ou com a lista, conforme a densidade do mapa
+ * @param lista Lista de antenas
+ * @return Conjunto com as posições afetadas, ou NULL em caso de erro
+ */
+ConjuntoEfeitos* calcularEfeitosAutomatico(Vertice* lista);
+
+/**
+ * @brief Liberta a grelha
+ * @param g Grelha
+ * @return 0 em caso de sucesso
+ */
+int libertarGrelha(GrelhaAntenas* g);
+
+#endif
@@ -0,0 +1,263 @@
+/**
+ * @file implicito.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação do grafo com ligações implícitas por frequência
+ * @version 0.1
+ * @date 2025-06-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "implicito.h"
+
+#pragma region Criar Grafo Implicito
+/**
+ * @brief Cria o grafo implícito de uma lista de antenas.
+ *
+ * Em vez de criar uma adjacência para cada par de antenas da mesma frequência (como
+ * CriarGrafo), agrupa as antenas por frequência (ordenação por contagem) e cada grupo
+ * representa todas as ligações entre os seus elementos. A memória fica O(N) qualquer
+ * que seja o tamanho de cada frequência. As adjacências que já existam na lista (por
+ * exemplo criadas com inserirAdjacencia) continuam a ser usadas como ligações explícitas.
+ * Se forem inseridas ou removidas antenas, o grafo tem de ser criado de novo.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @return Grafo criado (libertar com libertarGrafoImplicito), ou NULL em caso de erro.
+ */
+GrafoImplicito* criarGrafoImplicito(Vertice* lista) {
+    GrafoImplicito* g = (GrafoImplicito*)calloc(1, sizeof(GrafoImplicito));
+    if (!g) {
+        printf("Erro ao alocar memória para o grafo implícito!\n");
+        return NULL;
+    }
+    g->lista = lista;
+    for (Vertice* v = lista; v; v = v->prox) {
+        g->numVertices++;
+        g->inicio[(unsigned char)v->frequencia + 1]++;
+    }
+    for (int f = 0; f < 256; f++) g->inicio[f + 1] += g->inicio[f];
+    g->grupos = (Vertice**)malloc((size_t)(g->numVertices > 0 ? g->numVertices : 1) * sizeof(Vertice*));
+    if (!g->grupos) {
+        printf("Erro ao alocar memória para o grafo implícito!\n");
+        free(g);
+        return NULL;
+    }
+    int livre[256];
+    for (int f = 0; f < 256; f++) livre[f] = g->inicio[f];
+    for (Vertice* v = lista; v; v = v->prox) {
+        g->grupos[livre[(unsigned char)v->frequencia]++] = v;
+    }
+    return g;
+}
+
+/**
+ * @brief Liberta o grafo implícito. A lista de antenas e as suas adjacências não são libertadas.
+ *
+ * @param g Grafo implícito.
+ * @return 0 em caso de sucesso.
+ */
+int libertarGrafoImplicito(GrafoImplicito* g) {
+    if (!g) return 0;
+    free(g->grupos);
+    free(g);
+    return 0;
+}
+#pragma endregion
+#pragma region Vizinhos
+/**
+ * @brief Começa a percorrer os vizinhos de um vértice.
+ *
+ * Os vizinhos são as outras antenas da mesma frequência, seguidas das adjacências
+ * explícitas do vértice.
+ *
+ * @param g Grafo implícito.
+ * @param v Vértice cujos vizinhos se querem percorrer.
+ * @param it Estado da iteração (usado depois em proximoVizinho).
+ * @return 0 em caso de sucesso, -1 se os argumentos forem inválidos.
+ */
+int iniciarVizinhos(GrafoImplicito* g, Vertice* v, VizinhosImplicitos* it) {
+    if (!g || !v || !it) return -1;
+    unsigned char f = (unsigned char)v->frequencia;
+    it->v = v;
+    it->grupo = g->grupos + g->inicio[f];
+    it->fimGrupo = g->grupos + g->inicio[f + 1];
+    it->adj = v->adjacencias;
+    return 0;
+}
+
+/**
+ * @brief Devolve o próximo vizinho do vértice (o próprio vértice é saltado).
+ *
+ * @param it Estado criado por iniciarVizinhos.
+ * @return Próximo vizinho, ou NULL quando já não houver mais.
+ */
+Vertice* proximoVizinho(VizinhosImplicitos* it) {
+    while (it->grupo < it->fimGrupo) {
+        Vertice* w = *it->grupo++;
+        if (w != it->v) return w;
+    }
+    if (it->adj) {
+        Vertice* w = it->adj->destino;
+        it->adj = it->adj->next;
+        return w;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Calcula o número de vizinhos de um vértice sem os percorrer um a um.
+ *
+ * @param g Grafo implícito.
+ * @param v Vértice.
+ * @return Antenas da mesma frequência (menos o próprio) mais as adjacências explícitas.
+ */
+int grauImplicito(GrafoImplicito* g, Vertice* v) {
+    if (!g || !v) return 0;
+    unsigned char f = (unsigned char)v->frequencia;
+    int grau = g->inicio[f + 1] - g->inicio[f] - 1;
+    for (AdjD* adj = v->adjacencias; adj; adj = adj->next) {
+        grau++;
+    }
+    return grau;
+}
+
+/**
+ * @brief Conta as arestas do grafo (as que CriarGrafo criaria, mais as explícitas).
+ *
+ * @param g Grafo implícito.
+ * @return Número de arestas dirigidas.
+ */
+long long contarArestasImplicitas(GrafoImplicito* g) {
+    if (!g) return 0;
+    long long total = 0;
+    for (int f = 0; f < 256; f++) {
+        long long k = g->inicio[f + 1] - g->inicio[f];
+        total += k * (k - 1);
+    }
+    for (Vertice* v = g->lista; v; v = v->prox) {
+        for (AdjD* adj = v->adjacencias; adj; adj = adj->next) {
+            total++;
+        }
+    }
+    return total;
+}
+#pragma endregion
+#pragma region Pesquisa em Largura
+/**
+ * @brief Acrescenta um vértice à fila da BFS, aumentando-a se for preciso.
+ *
+ * A fila só cresce além de N quando há ligações explícitas para antenas fora da lista.
+ */
+static int enfileirar(Vertice*** fila, int** nivel, int* capacidade, int* fim, Vertice* v, int d) {
+    if (*fim == *capacidade) {
+        int nova = *capacidade * 2;
+        Vertice** f = (Vertice**)realloc(*fila, (size_t)nova * sizeof(Vertice*));
+        if (!f) return -1;
+        *fila = f;
+        int* n = (int*)realloc(*nivel, (size_t)nova * sizeof(int));
+        if (!n) return -1;
+        *nivel = n;
+        *capacidade = nova;
+    }
+    (*fila)[*fim] = v;
+    (*nivel)[*fim] = d;
+    (*fim)++;
+    return 0;
+}
+
+/**
+ * @brief BFS sobre o grafo implícito, que pára quando chega ao destino (se houver).
+ *
+ * Cada grupo de frequência só é expandido na primeira vez que se retira da fila um
+ * vértice dessa frequência: nesse momento todas as antenas da frequência ficam à
+ * distância d + 1, e nenhuma expansão posterior as poderia aproximar. Assim a pesquisa
+ * custa O(N + ligações explícitas) em vez de O(soma de k²). As visitas são marcadas
+ * no campo "epoca" (novaEpocaPesquisa).
+ *
+ * @param g Grafo implícito.
+ * @param inicio Vértice inicial.
+ * @param destino Vértice onde parar (NULL para visitar tudo o que é alcançável).
+ * @param distancia Onde guardar a distância até ao destino (-1 se não for alcançado).
+ * @return Número de vértices visitados, ou -1 em caso de erro de memória.
+ */
+static int percorrerImplicito(GrafoImplicito* g, Vertice* inicio, Vertice* destino, int* distancia) {
+    if (distancia) *distancia = -1;
+    int capacidade = g->numVertices > 0 ? g->numVertices : 1;
+    Vertice** fila = (Vertice**)malloc((size_t)capacidade * sizeof(Vertice*));
+    int* nivel = (int*)malloc((size_t)capacidade * sizeof(int));
+    if (!fila || !nivel) {
+        printf("Erro ao alocar memória para a pesquisa!\n");
+        free(fila);
+        free(nivel);
+        return -1;
+    }
+    unsigned char expandida[256] = { 0 };
+    unsigned int epoca = novaEpocaPesquisa();
+    int frente = 0, fim = 0, erro = 0;
+    inicio->epoca = epoca;
+    enfileirar(&fila, &nivel, &capacidade, &fim, inicio, 0);
+    while (frente < fim && !erro) {
+        Vertice* v = fila[frente];
+        int d = nivel[frente++];
+        if (v == destino) {
+            if (distancia) *distancia = d;
+            break;
+        }
+        unsigned char f = (unsigned char)v->frequencia;
+        if (!expandida[f]) {
+            expandida[f] = 1;
+            for (int i = g->inicio[f]; i < g->inicio[f + 1] && !erro; i++) {
+                Vertice* w = g->grupos[i];
+                if (w->epoca != epoca) {
+                    w->epoca = epoca;
+                    erro = enfileirar(&fila, &nivel, &capacidade, &fim, w, d + 1);
+                }
+            }
+        }
+        for (AdjD* adj = v->adjacencias; adj && !erro; adj = adj->next) {
+            Vertice* w = adj->destino;
+            if (w->epoca != epoca) {
+                w->epoca = epoca;
+                erro = enfileirar(&fila, &nivel, &capacidade, &fim, w, d + 1);
+            }
+        }
+    }
+    free(fila);
+    free(nivel);
+    if (erro) {
+        printf("Erro ao alocar memória para a pesquisa!\n");
+        return -1;
+    }
+    return fim;
+}
+
+/**
+ * @brief BFS a partir de um vértice no grafo implícito.
+ *
+ * @param g Grafo implícito.
+ * @param inicio Vértice inicial.
+ * @return Número de vértices alcançáveis (incluindo o inicial), ou -1 em caso de erro.
+ */
+int bfsImplicito(GrafoImplicito* g, Vertice* inicio) {
+    if (!g || !inicio) return -1;
+    return percorrerImplicito(g, inicio, NULL, NULL);
+}
+
+/**
+ * @brief Calcula o menor número de ligações entre dois vértices no grafo implícito.
+ *
+ * @param g Grafo implícito.
+ * @param origem Vértice de partida.
+ * @param destino Vértice de chegada.
+ * @return Número de ligações, -1 se o destino não for alcançável, -2 em caso de erro.
+ */
+int distanciaImplicita(GrafoImplicito* g, Vertice* origem, Vertice* destino) {
+    if (!g || !origem || !destino) return -2;
+    int distancia;
+    if (percorrerImplicito(g, origem, destino, &distancia) < 0) return -2;
+    return distancia;
+}
+#pragma endregion
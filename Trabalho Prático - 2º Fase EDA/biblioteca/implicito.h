@@ -0,0 +1,102 @@
+/**
+ * @file implicito.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Grafo com as ligações entre antenas da mesma frequência implícitas
+ * @version 0.1
+ * @date 2025-06-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef IMPLICITO_H
+#define IMPLICITO_H
+
+#include "grafo.h"
+
+/**
+ * @brief Grafo em que cada antena está ligada a todas as outras da mesma frequência
+ * sem criar as adjacências (k antenas de uma frequência custam k apontadores em vez de
+ * k(k-1) AdjD). As adjacências da lista de cada vértice (inserirAdjacencia) são
+ * ligações explícitas que se juntam às implícitas.
+ */
+typedef struct grafoImplicito {
+    Vertice* lista;              // Lista de antenas (não é copiada)
+    int numVertices;
+    Vertice** grupos;            // Antenas agrupadas por frequência, pela ordem da lista
+    int inicio[257];             // Início de cada frequência em grupos
+} GrafoImplicito;
+
+/**
+ * @brief Percorre os vizinhos de um vértice: primeiro os da mesma frequência, depois os explícitos.
+ */
+typedef struct vizinhosImplicitos {
+    Vertice* v;
+    Vertice** grupo;             // Próximo vizinho da mesma frequência
+    Vertice** fimGrupo;
+    AdjD* adj;                   // Próxima ligação explícita
+} VizinhosImplicitos;
+
+/**
+ * @brief Cria o grafo implícito de uma lista de antenas (sem criar adjacências)
+ * @param lista Lista de antenas
+ * @return Grafo criado, ou NULL em caso de erro
+ */
+GrafoImplicito* criarGrafoImplicito(Vertice* lista);
+
+/**
+ * @brief Começa a percorrer os vizinhos de um vértice
+ * @param g Grafo implícito
+ * @param v Vértice
+ * @param it Estado a preencher
+ * @return 0 em caso de sucesso
+ */
+int iniciarVizinhos(GrafoImplicito* g, Vertice* v, VizinhosImplicitos* it);
+
+/**
+ * @brief Devolve o próximo vizinho
+ * @param it Estado criado por iniciarVizinhos
+ * @return Próximo vizinho, ou NULL quando já não houver
+ */
+Vertice* proximoVizinho(VizinhosImplicitos* it);
+
+/**
+ * @brief Número de vizinhos de um vértice (implícitos e explícitos)
+ * @param g Grafo implícito
+ * @param v Vértice
+ * @return Grau de saída do vértice
+ */
+int grauImplicito(GrafoImplicito* g, Vertice* v);
+
+/**
+ * @brief Número de arestas que o grafo teria se fosse criado com CriarGrafo (mais as explícitas)
+ * @param g Grafo implícito
+ * @return Número de arestas
+ */
+long long contarArestasImplicitas(GrafoImplicito* g);
+
+/**
+ * @brief BFS a partir de um vértice, expandindo cada frequência uma só vez
+ * @param g Grafo implícito
+ * @param inicio Vértice inicial
+ * @return Número de vértices visitados, ou -1 em caso de erro
+ */
+int bfsImplicito(GrafoImplicito* g, Vertice* inicio);
+
+/**
+ * @brief Menor número de ligações entre dois vértices
+ * @param g Grafo implícito
+ * @param origem Vértice de partida
+ * @param destino Vértice de chegada
+ * @return Número de ligações, -1 se não houver caminho, -2 em caso de erro
+ */
+int distanciaImplicita(GrafoImplicito* g, Vertice* origem, Vertice* destino);
+
+/**
+ * @brief Liberta o grafo implícito (a lista de antenas não é libertada)
+ * @param g Grafo implícito
+ * @return 0 em caso de sucesso
+ */
+int libertarGrafoImplicito(GrafoImplicito* g);
+
+#endif
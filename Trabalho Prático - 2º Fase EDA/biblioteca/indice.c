@@ -0,0 +1,233 @@
+/**
+ * @file indice.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação do índice de coordenadas sobre a tabela de posições (posicoes.h)
+ * @version 0.1
+ * @date 2025-05-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "indice.h"
+#include "quadtree.h"
+#include "efeitos.h"
+
+#pragma region Criar Índice
+/**
+ * @brief Cria um índice vazio com capacidade para o número de células indicado.
+ *
+ * @param capacidade Número de células previsto (0 para o valor por omissão).
+ * @return Apontador para o índice, ou NULL em caso de erro de memória.
+ */
+IndiceAntenas* criarIndice(int capacidade) {
+    IndiceAntenas* indice = (IndiceAntenas*)malloc(sizeof(IndiceAntenas));
+    if (!indice) {
+        printf("Erro ao alocar memória para o índice!\n");
+        return NULL;
+    }
+    int celulas = iniciarTabelaPosicoes(&indice->celulas, capacidade);
+    int linhas = iniciarTabelaPosicoes(&indice->linhas, 0);
+    if (!celulas || !linhas) {
+        printf("Erro ao alocar memória para o índice!\n");
+        libertarTabelaPosicoes(&indice->celulas);
+        libertarTabelaPosicoes(&indice->linhas);
+        free(indice);
+        return NULL;
+    }
+    indice->cauda = NULL;
+    indice->espacial = NULL;
+    indice->efeitos = NULL;
+    return indice;
+}
+#pragma endregion
+#pragma region Procurar
+/**
+ * @brief Procura o primeiro vértice da lista com as coordenadas (x, y).
+ *
+ * @param indice Índice de coordenadas.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Apontador para o vértice, ou NULL se não existir.
+ */
+Vertice* procurarIndice(IndiceAntenas* indice, int x, int y) {
+    if (!indice) return NULL;
+    return (Vertice*)procurarPosicao(&indice->celulas, x, y);
+}
+
+/**
+ * @brief Procura uma antena com a frequência e coordenadas indicadas.
+ *
+ * Percorre apenas as antenas da célula (x, y), que estão seguidas na lista.
+ *
+ * @param indice Índice de coordenadas.
+ * @param frequencia Frequência da antena.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Apontador para o vértice, ou NULL se não existir.
+ */
+Vertice* procurarAntenaIndice(IndiceAntenas* indice, char frequencia, int x, int y) {
+    Vertice* aux = procurarIndice(indice, x, y);
+    while (aux && aux->x == x && aux->y == y) {
+        if (aux->frequencia == frequencia) {
+            return aux;
+        }
+        aux = aux->prox;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Encontra o vértice depois do qual deve ficar uma antena nova em (x, y).
+ *
+ * Se a célula já existir, a antena nova fica antes das que lá estão (tal como em
+ * InsereAntena). Caso contrário, parte do último vértice da linha x (ou da linha
+ * anterior mais próxima que tenha antenas) e recua só dentro da linha. O custo é
+ * O(1) para uma antena que fica no fim da sua linha (leitura de um ficheiro) e, no
+ * pior caso, proporcional ao número de antenas da linha mais o número de linhas
+ * vazias que há antes dela. Se houver mais linhas a percorrer do que células
+ * ocupadas (coordenadas muito dispersas), recua a partir da cauda.
+ *
+ * @param indice Índice de coordenadas.
+ * @param head Cabeça da lista.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Vértice anterior, ou NULL se a antena ficar no início da lista.
+ */
+Vertice* antecessorIndice(IndiceAntenas* indice, Vertice* head, int x, int y) {
+    if (!indice || !head) return NULL;
+    Vertice* celula = procurarIndice(indice, x, y);
+    if (celula) return celula->ant;
+    if (head->x > x || (head->x == x && head->y > y)) return NULL;
+    if ((long long)x - head->x > indice->celulas.ocupadas) {
+        Vertice* aux = indice->cauda;
+        while (aux && (aux->x > x || (aux->x == x && aux->y > y))) {
+            aux = aux->ant;
+        }
+        return aux;
+    }
+    // Há uma antena antes de (x, y), por isso alguma linha entre head->x e x tem antenas
+    for (int linha = x; linha >= head->x; linha--) {
+        Vertice* ultimo = (Vertice*)procurarPosicao(&indice->linhas, linha, 0);
+        if (!ultimo) continue;
+        while (ultimo && ultimo->x == x && ultimo->y > y) {
+            ultimo = ultimo->ant;
+        }
+        return ultimo;
+    }
+    return NULL;
+}
+#pragma endregion
+#pragma region Registar
+/**
+ * @brief Regista um vértice que acabou de ser ligado à lista.
+ *
+ * O vértice passa a ser o primeiro da sua célula se o anterior for de outra célula,
+ * o último da sua linha se o seguinte for de outra linha e a cauda se não houver
+ * seguinte. Se faltar memória nada é alterado.
+ *
+ * @param indice Índice de coordenadas.
+ * @param v Vértice já ligado através de ant e prox.
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+int registarVerticeIndice(IndiceAntenas* indice, Vertice* v) {
+    if (!indice || !v) return 0;
+    int primeiroCelula = !v->ant || v->ant->x != v->x || v->ant->y != v->y;
+    int ultimoLinha = !v->prox || v->prox->x != v->x;
+    Vertice* linhaAnterior = (Vertice*)procurarPosicao(&indice->linhas, v->x, 0);
+    if (ultimoLinha && !definirPosicao(&indice->linhas, v->x, 0, v)) {
+        return 0;
+    }
+    if (primeiroCelula && !definirPosicao(&indice->celulas, v->x, v->y, v)) {
+        // Repor a linha (substituir uma posição existente não falha)
+        if (ultimoLinha) {
+            if (linhaAnterior) {
+                definirPosicao(&indice->linhas, v->x, 0, linhaAnterior);
+            } else {
+                retirarPosicao(&indice->linhas, v->x, 0);
+            }
+        }
+        return 0;
+    }
+    if (!v->prox) indice->cauda = v;
+    return 1;
+}
+
+/**
+ * @brief Retira do índice um vértice que vai sair da lista.
+ *
+ * A célula passa para a antena seguinte da mesma célula e a linha para a antena
+ * anterior da mesma linha; se não houver, deixam de existir.
+ *
+ * @param indice Índice de coordenadas.
+ * @param v Vértice ainda ligado à lista.
+ * @return 0 em caso de sucesso.
+ */
+int retirarVerticeIndice(IndiceAntenas* indice, Vertice* v) {
+    if (!indice || !v) return 0;
+    if (procurarIndice(indice, v->x, v->y) == v) {
+        if (v->prox && v->prox->x == v->x && v->prox->y == v->y) {
+            definirPosicao(&indice->celulas, v->x, v->y, v->prox);
+        } else {
+            retirarPosicao(&indice->celulas, v->x, v->y);
+        }
+    }
+    if (procurarPosicao(&indice->linhas, v->x, 0) == v) {
+        if (v->ant && v->ant->x == v->x) {
+            definirPosicao(&indice->linhas, v->x, 0, v->ant);
+        } else {
+            retirarPosicao(&indice->linhas, v->x, 0);
+        }
+    }
+    if (indice->cauda == v) {
+        indice->cauda = v->ant;
+    }
+    return 0;
+}
+#pragma endregion
+#pragma region Construir Índice
+/**
+ * @brief Constrói o índice de uma lista de antenas já existente.
+ *
+ * Regista em cada célula o primeiro vértice da lista com essas coordenadas, em cada
+ * linha o último vértice e guarda o último vértice como cauda.
+ *
+ * @param lista Lista de antenas ordenada por (x, y).
+ * @return Apontador para o índice, ou NULL em caso de erro.
+ */
+IndiceAntenas* construirIndice(Vertice* lista) {
+    int total = 0;
+    for (Vertice* aux = lista; aux; aux = aux->prox) {
+        total++;
+    }
+    IndiceAntenas* indice = criarIndice(total);
+    if (!indice) return NULL;
+    for (Vertice* aux = lista; aux; aux = aux->prox) {
+        if (!registarVerticeIndice(indice, aux)) {
+            printf("Erro ao alocar memória para o índice!\n");
+            libertarIndice(indice);
+            return NULL;
+        }
+    }
+    return indice;
+}
+#pragma endregion
+#pragma region Libertar Índice
+/**
+ * @brief Liberta a memória do índice (e da quadtree e dos efeitos associados). Os vértices continuam na lista.
+ *
+ * @param indice Índice a libertar.
+ * @return 0 em caso de sucesso.
+ */
+int libertarIndice(IndiceAntenas* indice) {
+    if (!indice) return 0;
+    libertarQuadtree(indice->espacial);
+    libertarRastreadorEfeitos(indice->efeitos);
+    libertarTabelaPosicoes(&indice->celulas);
+    libertarTabelaPosicoes(&indice->linhas);
+    free(indice);
+    return 0;
+}
+#pragma endregion
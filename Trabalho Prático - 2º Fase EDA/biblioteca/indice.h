@@ -0,0 +1,101 @@
+/**
+ * @file indice.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Índice de coordenadas (tabela de dispersão) mantido em conjunto com a lista de antenas
+ * @version 0.1
+ * @date 2025-05-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef INDICE_H
+#define INDICE_H
+
+#include "grafo.h"
+#include "posicoes.h"
+
+/**
+ * @brief Índice de coordenadas das antenas.
+ *
+ * Cada célula (x, y) aponta para o primeiro vértice da lista com essas coordenadas.
+ * Como a lista está ordenada por (x, y), as antenas da mesma célula (frequências
+ * diferentes) ficam seguidas na lista a partir desse vértice. Cada linha x aponta
+ * para o último vértice da lista nessa linha, o que permite encontrar o lugar de
+ * uma antena nova sem percorrer a lista desde o início (antecessorIndice).
+ */
+struct indiceAntenas {
+    TabelaPosicoes celulas;      // (x, y) -> primeiro vértice da célula
+    TabelaPosicoes linhas;       // (x, 0) -> último vértice da linha x
+    Vertice* cauda;              // Último vértice da lista (inserção ordenada em O(1))
+    struct quadtreeAntenas* espacial; // Quadtree atualizada com o índice (NULL se não for usada, ver quadtree.h)
+    struct rastreadorEfeitos* efeitos; // Efeitos nefastos atualizados com o índice (NULL se não forem usados, ver efeitos.h)
+};
+
+/**
+ * @brief Cria um índice vazio
+ * @param capacidade Número de células previsto (0 para o valor por omissão)
+ * @return Apontador para o índice, ou NULL em caso de erro
+ */
+IndiceAntenas* criarIndice(int capacidade);
+
+/**
+ * @brief Cria um índice a partir de uma lista de antenas já existente
+ * @param lista Lista de antenas ordenada
+ * @return Apontador para o índice, ou NULL em caso de erro
+ */
+IndiceAntenas* construirIndice(Vertice* lista);
+
+/**
+ * @brief Procura o primeiro vértice da lista com as coordenadas indicadas
+ * @param indice Índice de coordenadas
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Apontador para o vértice, ou NULL se não existir
+ */
+Vertice* procurarIndice(IndiceAntenas* indice, int x, int y);
+
+/**
+ * @brief Procura uma antena pela frequência e coordenadas
+ * @param indice Índice de coordenadas
+ * @param frequencia Frequência da antena
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Apontador para o vértice, ou NULL se não existir
+ */
+Vertice* procurarAntenaIndice(IndiceAntenas* indice, char frequencia, int x, int y);
+
+/**
+ * @brief Vértice depois do qual fica uma antena nova em (x, y)
+ * @param indice Índice de coordenadas
+ * @param head Cabeça da lista
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Vértice anterior, ou NULL se a antena ficar no início da lista
+ */
+Vertice* antecessorIndice(IndiceAntenas* indice, Vertice* head, int x, int y);
+
+/**
+ * @brief Regista um vértice que acabou de ser ligado à lista
+ * @param indice Índice de coordenadas
+ * @param v Vértice (já ligado através de ant e prox)
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória (o índice fica como estava)
+ */
+int registarVerticeIndice(IndiceAntenas* indice, Vertice* v);
+
+/**
+ * @brief Retira do índice um vértice que vai sair da lista
+ * @param indice Índice de coordenadas
+ * @param v Vértice (ainda ligado à lista)
+ * @return 0 em caso de sucesso
+ */
+int retirarVerticeIndice(IndiceAntenas* indice, Vertice* v);
+
+/**
+ * @brief Liberta a memória do índice (não liberta os vértices)
+ * @param indice Índice de coordenadas
+ * @return 0 em caso de sucesso
+ */
+int libertarIndice(IndiceAntenas* indice);
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file intersecoes.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação das interseções com fusão de vetores ordenados (AVX2 ou escalar)
+ * @version 0.1
+ * @date 2025-06-07
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "intersecoes.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define INTERSECOES_AVX2 1
+#endif
+
+#pragma region Chaves
+/**
+ * @brief Converte (x, y) numa chave de 64 bits: x nos 32 bits de cima e y nos de baixo,
+ * com o bit de sinal trocado para que a ordem das chaves sem sinal seja a ordem de (x, y).
+ *
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Chave da posição.
+ */
+uint64_t chavePosicao(int x, int y) {
+    return ((uint64_t)((uint32_t)x ^ 0x80000000u) << 32) | ((uint32_t)y ^ 0x80000000u);
+}
+
+/**
+ * @brief Compara chaves (para o qsort).
+ */
+static int compararChaves(const void* a, const void* b) {
+    uint64_t p = *(const uint64_t*)a, q = *(const uint64_t*)b;
+    return (p > q) - (p < q);
+}
+
+/**
+ * @brief Cria o vetor ordenado das chaves das antenas de uma frequência.
+ *
+ * A lista criada por InsereAntena já está ordenada por (x, y), por isso normalmente
+ * basta copiar as chaves; só se a ordem não se verificar é que o vetor é ordenado.
+ * As chaves repetidas são retiradas.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param frequencia Frequência das antenas.
+ * @param chaves Onde fica o vetor de chaves (libertar com free).
+ * @return Número de chaves, ou -1 em caso de erro de memória.
+ */
+int chavesFrequencia(Vertice* lista, char frequencia, uint64_t** chaves) {
+    int n = 0;
+    for (Vertice* v = lista; v; v = v->prox) {
+        if (v->frequencia == frequencia) n++;
+    }
+    *chaves = (uint64_t*)malloc((size_t)(n > 0 ? n : 1) * sizeof(uint64_t));
+    if (!*chaves) return -1;
+    int ordenado = 1, k = 0;
+    for (Vertice* v = lista; v; v = v->prox) {
+        if (v->frequencia != frequencia) continue;
+        (*chaves)[k] = chavePosicao(v->x, v->y);
+        if (k > 0 && (*chaves)[k] < (*chaves)[k - 1]) ordenado = 0;
+        k++;
+    }
+    if (!ordenado) qsort(*chaves, (size_t)n, sizeof(uint64_t), compararChaves);
+    int m = 0;
+    for (k = 0; k < n; k++) {
+        if (m == 0 || (*chaves)[k] != (*chaves)[m - 1]) (*chaves)[m++] = (*chaves)[k];
+    }
+    return m;
+}
+#pragma endregion
+#pragma region Fusão
+/**
+ * @brief Interseção de dois vetores ordenados com uma fusão (merge) escalar.
+ *
+ * @param a Primeiro vetor (ordenado, sem repetições).
+ * @param na Tamanho do primeiro vetor.
+ * @param b Segundo vetor (ordenado, sem repetições).
+ * @param nb Tamanho do segundo vetor.
+ * @param saida Onde são escritas as chaves comuns, por ordem.
+ * @return Número de chaves comuns.
+ */
+size_t intersetarChavesEscalar(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* saida) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            saida[k++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return k;
+}
+
+#ifdef INTERSECOES_AVX2
+/**
+ * @brief Interseção com AVX2: compara blocos de 4 chaves de a com as 4 rotações de um
+ * bloco de b (16 comparações em 4 instruções) e avança o bloco com o maior valor menor.
+ *
+ * Como as chaves não se repetem, cada chave de a só pode ser igual a uma de b, e um bloco
+ * só é abandonado quando todas as suas chaves já foram comparadas com o bloco da outra
+ * lista onde poderiam estar. O resto é tratado pela fusão escalar.
+ */
+__attribute__((target("avx2")))
+static size_t intersetarChavesAVX2(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* saida) {
+    size_t i = 0, j = 0, k = 0;
+    while (i + 4 <= na && j + 4 <= nb) {
+        __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i*)(b + j));
+        __m256i iguais = _mm256_cmpeq_epi64(va, vb);
+        iguais = _mm256_or_si256(iguais, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x39)));
+        iguais = _mm256_or_si256(iguais, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x4E)));
+        iguais = _mm256_or_si256(iguais, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x93)));
+        int mascara = _mm256_movemask_pd(_mm256_castsi256_pd(iguais));
+        while (mascara) {
+            int p = __builtin_ctz((unsigned int)mascara);
+            saida[k++] = a[i + p];
+            mascara &= mascara - 1;
+        }
+        uint64_t maiorA = a[i + 3], maiorB = b[j + 3];
+        if (maiorA <= maiorB) i += 4;
+        if (maiorB <= maiorA) j += 4;
+    }
+    // O bloco restante de uma lista ainda pode ter chaves iguais às da outra
+    return k + intersetarChavesEscalar(a + i, na - i, b + j, nb - j, saida + k);
+}
+#endif
+
+/**
+ * @brief Interseção de dois vetores ordenados de chaves, escolhendo a implementação.
+ *
+ * Usa a versão AVX2 quando o processador a suporta (verificado durante a execução) e
+ * a fusão escalar nos restantes casos. O resultado é o mesmo nas duas versões. O custo
+ * é O(na + nb).
+ *
+ * @param a Primeiro vetor (ordenado, sem repetições).
+ * @param na Tamanho do primeiro vetor.
+ * @param b Segundo vetor (ordenado, sem repetições).
+ * @param nb Tamanho do segundo vetor.
+ * @param saida Onde são escritas as chaves comuns, por ordem.
+ * @return Número de chaves comuns.
+ */
+size_t intersetarChaves(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* saida) {
+#ifdef INTERSECOES_AVX2
+    static int temAVX2 = -1;
+    if (temAVX2 < 0) {
+        __builtin_cpu_init();
+        temAVX2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    if (temAVX2) return intersetarChavesAVX2(a, na, b, nb, saida);
+#endif
+    return intersetarChavesEscalar(a, na, b, nb, saida);
+}
+#pragma endregion
+#pragma region Calcular Interseções
+/**
+ * @brief Calcula as posições onde existem antenas das duas frequências.
+ *
+ * As antenas de cada frequência são passadas a vetores ordenados de chaves
+ * (chavesFrequencia) que depois são intersetados (intersetarChaves), por isso o custo é
+ * linear no número de antenas em vez de comparar todos os pares.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param f1 Primeira frequência.
+ * @param f2 Segunda frequência.
+ * @return Posições comuns ordenadas por (x, y) (vazio se f1 == f2), ou NULL em caso de erro.
+ */
+ResultadoIntersecoes* calcularIntersecoes(Vertice* lista, char f1, char f2) {
+    ResultadoIntersecoes* r = (ResultadoIntersecoes*)calloc(1, sizeof(ResultadoIntersecoes));
+    uint64_t* a = NULL;
+    uint64_t* b = NULL;
+    uint64_t* comuns = NULL;
+    int na = 0, nb = 0;
+    int erro = !r;
+    if (!erro && f1 != f2) {
+        na = chavesFrequencia(lista, f1, &a);
+        nb = chavesFrequencia(lista, f2, &b);
+        erro = na < 0 || nb < 0;
+    }
+    if (!erro && f1 != f2) {
+        comuns = (uint64_t*)malloc((size_t)(na < nb ? na : nb) * sizeof(uint64_t) + 1);
+        r->posicoes = (Coordenada*)malloc((size_t)(na < nb ? na : nb) * sizeof(Coordenada) + 1);
+        erro = !comuns || !r->posicoes;
+    }
+    if (!erro && f1 != f2) {
+        r->num = (int)intersetarChaves(a, (size_t)na, b, (size_t)nb, comuns);
+        for (int i = 0; i < r->num; i++) {
+            r->posicoes[i].x = (int)((uint32_t)(comuns[i] >> 32) ^ 0x80000000u);
+            r->posicoes[i].y = (int)((uint32_t)comuns[i] ^ 0x80000000u);
+        }
+    }
+    free(a);
+    free(b);
+    free(comuns);
+    if (erro) {
+        printf("Erro ao alocar memória para as interseções!\n");
+        libertarIntersecoes(r);
+        return NULL;
+    }
+    return r;
+}
+
+/**
+ * @brief Liberta o resultado de calcularIntersecoes.
+ *
+ * @param r Resultado.
+ * @return 0 em caso de sucesso.
+ */
+int libertarIntersecoes(ResultadoIntersecoes* r) {
+    if (!r) return 0;
+    free(r->posicoes);
+    free(r);
+    return 0;
+}
+#pragma endregion
@@ -0,0 +1,83 @@
+/**
+ * @file intersecoes.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Interseções entre frequências com chaves ordenadas de 64 bits
+ * @version 0.1
+ * @date 2025-06-07
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef INTERSECOES_H
+#define INTERSECOES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "grafo.h"
+#include "efeitos.h"
+
+/**
+ * @brief Posições onde existem antenas das duas frequências pesquisadas.
+ */
+typedef struct resultadoIntersecoes {
+    int num;
+    Coordenada* posicoes;        // Ordenadas por (x, y)
+} ResultadoIntersecoes;
+
+/**
+ * @brief Converte uma posição numa chave de 64 bits com a mesma ordem que (x, y)
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Chave da posição
+ */
+uint64_t chavePosicao(int x, int y);
+
+/**
+ * @brief Cria o vetor ordenado (sem repetições) das chaves das antenas de uma frequência
+ * @param lista Lista de antenas
+ * @param frequencia Frequência
+ * @param chaves Onde fica o vetor (libertar com free)
+ * @return Número de chaves, ou -1 em caso de erro
+ */
+int chavesFrequencia(Vertice* lista, char frequencia, uint64_t** chaves);
+
+/**
+ * @brief Interseção de dois vetores ordenados de chaves sem repetições
+ * @param a Primeiro vetor
+ * @param na Tamanho do primeiro vetor
+ * @param b Segundo vetor
+ * @param nb Tamanho do segundo vetor
+ * @param saida Vetor com espaço para o menor dos dois tamanhos
+ * @return Número de chaves comuns (escritas por ordem em saida)
+ */
+size_t intersetarChaves(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* saida);
+
+/**
+ * @brief Interseção de dois vetores de chaves sem instruções vetoriais
+ * @param a Primeiro vetor
+ * @param na Tamanho do primeiro vetor
+ * @param b Segundo vetor
+ * @param nb Tamanho do segundo vetor
+ * @param saida Vetor com espaço para o menor dos dois tamanhos
+ * @return Número de chaves comuns
+ */
+size_t intersetarChavesEscalar(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* saida);
+
+/**
+ * @brief Calcula as posições com antenas das duas frequências
+ * @param lista Lista de antenas
+ * @param f1 Primeira frequência
+ * @param f2 Segunda frequência
+ * @return Resultado (libertar com libertarIntersecoes), ou NULL em caso de erro
+ */
+ResultadoIntersecoes* calcularIntersecoes(Vertice* lista, char f1, char f2);
+
+/**
+ * @brief Liberta o resultado de calcularIntersecoes
+ * @param r Resultado
+ * @return 0 em caso de sucesso
+ */
+int libertarIntersecoes(ResultadoIntersecoes* r);
+
+#endif
@@ -0,0 +1,238 @@
+/**
+ * @file leitura.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da leitura do mapa de antenas mapeado em memória
+ * @version 0.1
+ * @date 2025-05-26
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "leitura.h"
+#include "memoria.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#pragma region Mapear Ficheiro
+/**
+ * @brief Abre um ficheiro e mapeia o seu conteúdo em memória só para leitura.
+ *
+ * Em Windows usa CreateFileMapping/MapViewOfFile e nos restantes sistemas mmap.
+ * Um ficheiro vazio é aceite (dados = NULL, tamanho = 0).
+ *
+ * @param nomeFicheiro Nome do ficheiro a mapear.
+ * @param f Estrutura onde fica o mapeamento.
+ * @return 1 em caso de sucesso, 0 em caso de erro.
+ */
+int mapearFicheiro(const char* nomeFicheiro, FicheiroMapeado* f) {
+    if (!nomeFicheiro || !f) return 0;
+    f->dados = NULL;
+    f->tamanho = 0;
+    f->sistema = NULL;
+#ifdef _WIN32
+    HANDLE ficheiro = CreateFileA(nomeFicheiro, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (ficheiro == INVALID_HANDLE_VALUE) return 0;
+    LARGE_INTEGER tamanho;
+    if (!GetFileSizeEx(ficheiro, &tamanho)) {
+        CloseHandle(ficheiro);
+        return 0;
+    }
+    if (tamanho.QuadPart > 0) {
+        HANDLE mapa = CreateFileMappingA(ficheiro, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!mapa) {
+            CloseHandle(ficheiro);
+            return 0;
+        }
+        f->dados = (const char*)MapViewOfFile(mapa, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapa);  // A vista mantém o mapeamento ativo
+        if (!f->dados) {
+            CloseHandle(ficheiro);
+            return 0;
+        }
+        f->tamanho = (size_t)tamanho.QuadPart;
+    }
+    CloseHandle(ficheiro);
+#else
+    int fd = open(nomeFicheiro, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return 0;
+    }
+    if (info.st_size > 0) {
+        void* dados = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (dados == MAP_FAILED) {
+            close(fd);
+            return 0;
+        }
+        madvise(dados, (size_t)info.st_size, MADV_SEQUENTIAL);
+        f->dados = (const char*)dados;
+        f->tamanho = (size_t)info.st_size;
+    }
+    close(fd);  // O mapeamento continua válido depois de fechar o descritor
+#endif
+    return 1;
+}
+
+/**
+ * @brief Desfaz o mapeamento feito por mapearFicheiro.
+ *
+ * @param f Ficheiro mapeado.
+ * @return 0 em caso de sucesso.
+ */
+int desmapearFicheiro(FicheiroMapeado* f) {
+    if (!f || !f->dados) return 0;
+#ifdef _WIN32
+    UnmapViewOfFile((LPCVOID)f->dados);
+#else
+    munmap((void*)f->dados, f->tamanho);
+#endif
+    f->dados = NULL;
+    f->tamanho = 0;
+    return 0;
+}
+#pragma endregion
+#pragma region Procurar Antena na Linha
+/**
+ * @brief Procura o próximo byte diferente de '.' entre inicio e fim.
+ *
+ * Com SSE2 compara 16 bytes de cada vez com '.'; sem SSE2 compara 8 bytes de
+ * cada vez dentro de um inteiro de 64 bits. As zonas vazias do mapa (só pontos)
+ * são assim saltadas sem olhar para cada caracter.
+ *
+ * @param inicio Início da zona a procurar.
+ * @param fim Fim da zona (exclusivo).
+ * @return Apontador para o primeiro byte diferente de '.', ou fim se não existir.
+ */
+const char* procurarDiferenteDePonto(const char* inicio, const char* fim) {
+    const char* p = inicio;
+#if defined(__SSE2__)
+    const __m128i pontos = _mm_set1_epi8('.');
+    while (fim - p >= 16) {
+        __m128i bloco = _mm_loadu_si128((const __m128i*)p);
+        int iguais = _mm_movemask_epi8(_mm_cmpeq_epi8(bloco, pontos));
+        if (iguais != 0xFFFF) {
+            int diferentes = ~iguais & 0xFFFF;
+            return p + __builtin_ctz((unsigned int)diferentes);
+        }
+        p += 16;
+    }
+#else
+    const uint64_t pontos = 0x2E2E2E2E2E2E2E2EULL;
+    while (fim - p >= 8) {
+        uint64_t bloco;
+        memcpy(&bloco, p, 8);
+        if (bloco != pontos) break;  // Há pelo menos um caracter diferente neste bloco
+        p += 8;
+    }
+#endif
+    while (p < fim && *p == '.') {
+        p++;
+    }
+    return p;
+}
+#pragma endregion
+#pragma region Carregar Antenas Mapeado
+/**
+ * @brief Carrega as antenas de um ficheiro de texto mapeado em memória.
+ *
+ * O ficheiro tem o mesmo formato que o lido por carregarAntenasDeFicheiro (uma linha
+ * do mapa por linha de texto, '.' para posições vazias), mas as linhas podem ter
+ * qualquer largura. Cada linha é delimitada com memchr e as antenas são procuradas
+ * com procurarDiferenteDePonto. Como o ficheiro está ordenado por (linha, coluna),
+ * cada nova antena é ligada no fim da lista, que fica ordenada sem comparações.
+ * Os caracteres ' ' e '\r' (ficheiros com fim de linha de Windows) são ignorados.
+ *
+ * @param nomeFicheiro Nome do ficheiro de texto a ler (ex: "antenas.txt").
+ * @return Apontador para a lista ligada de vértices, ou NULL se não houver antenas ou em caso de erro.
+ */
+Vertice* carregarAntenasMapeado(const char* nomeFicheiro) {
+    return carregarAntenasMapeadoArena(nomeFicheiro, NULL);
+}
+
+/**
+ * @brief Carrega as antenas de um ficheiro mapeado em memória, criando os vértices numa arena.
+ *
+ * Igual a carregarAntenasMapeado, mas os vértices são retirados da arena. A lista
+ * é libertada com libertarArena (não com libertarMemoria).
+ *
+ * @param nomeFicheiro Nome do ficheiro de texto a ler.
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc).
+ * @return Apontador para a lista ligada de vértices, ou NULL se não houver antenas ou em caso de erro.
+ */
+Vertice* carregarAntenasMapeadoArena(const char* nomeFicheiro, ArenaGrafo* arena) {
+    FicheiroMapeado f;
+    if (!mapearFicheiro(nomeFicheiro, &f)) {
+        return NULL;
+    }
+    Vertice* lista = lerGrelha(f.dados, f.tamanho, arena);
+    desmapearFicheiro(&f);
+    return lista;
+}
+
+/**
+ * @brief Cria a lista de antenas a partir do texto de um mapa em grelha já em memória.
+ *
+ * Cada linha é delimitada com memchr e as antenas são procuradas com
+ * procurarDiferenteDePonto. Como o texto está ordenado por (linha, coluna), cada nova
+ * antena é ligada no fim da lista, que fica ordenada sem comparações.
+ *
+ * @param dados Texto do mapa.
+ * @param tamanho Número de bytes.
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc).
+ * @return Apontador para a lista ligada de vértices, ou NULL se não houver antenas ou em caso de erro de memória.
+ */
+Vertice* lerGrelha(const char* dados, size_t tamanho, ArenaGrafo* arena) {
+    Vertice* lista = NULL;
+    Vertice* cauda = NULL;
+    if (!dados) return NULL;
+    const char* p = dados;
+    const char* fimFicheiro = dados + tamanho;
+    int linha = 0;
+    while (p < fimFicheiro) {
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fimFicheiro - p));
+        if (!fimLinha) fimLinha = fimFicheiro;
+        const char* c = procurarDiferenteDePonto(p, fimLinha);
+        while (c < fimLinha) {
+            if (*c != ' ' && *c != '\r') {
+                Vertice* nova = criarAntenaArena(arena, *c, linha + 1, (int)(c - p) + 1);
+                if (!nova) {
+                    printf("Erro ao alocar memória para as antenas!\n");
+                    // Sem arena os vértices já criados são libertados; com arena ficam para libertarArena
+                    if (!arena) libertarMemoria(lista);
+                    return NULL;
+                }
+                nova->ant = cauda;
+                if (cauda) {
+                    cauda->prox = nova;
+                } else {
+                    lista = nova;
+                }
+                cauda = nova;
+            }
+            c = procurarDiferenteDePonto(c + 1, fimLinha);
+        }
+        p = fimLinha + 1;
+        linha++;
+    }
+    return lista;
+}
+#pragma endregion
@@ -0,0 +1,74 @@
+/**
+ * @file leitura.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Leitura rápida do mapa de antenas com o ficheiro mapeado em memória
+ * @version 0.1
+ * @date 2025-05-26
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef LEITURA_H
+#define LEITURA_H
+
+#include <stddef.h>
+#include "grafo.h"
+
+/**
+ * @brief Ficheiro aberto só para leitura e mapeado em memória.
+ */
+typedef struct ficheiroMapeado {
+    const char* dados;           // Conteúdo do ficheiro
+    size_t tamanho;              // Número de bytes
+    void* sistema;               // Informação interna do sistema operativo
+} FicheiroMapeado;
+
+/**
+ * @brief Mapeia um ficheiro em memória para leitura
+ * @param nomeFicheiro Nome do ficheiro
+ * @param f Estrutura a preencher
+ * @return 1 em caso de sucesso, 0 em caso de erro
+ */
+int mapearFicheiro(const char* nomeFicheiro, FicheiroMapeado* f);
+
+/**
+ * @brief Desfaz o mapeamento de um ficheiro
+ * @param f Ficheiro mapeado
+ * @return 0 em caso de sucesso
+ */
+int desmapearFicheiro(FicheiroMapeado* f);
+
+/**
+ * @brief Procura o próximo caracter de uma linha que não seja '.'
+ * @param inicio Início da zona a procurar
+ * @param fim Fim da zona (exclusivo)
+ * @return Apontador para o caracter encontrado, ou fim se não houver
+ */
+const char* procurarDiferenteDePonto(const char* inicio, const char* fim);
+
+/**
+ * @brief Carrega as antenas de um ficheiro de texto mapeado em memória
+ * @param nomeFicheiro Nome do ficheiro a ler (ex: "antenas.txt")
+ * @return Apontador para a lista carregada (NULL se o ficheiro não existir ou estiver vazio)
+ */
+Vertice* carregarAntenasMapeado(const char* nomeFicheiro);
+
+/**
+ * @brief Carrega as antenas de um ficheiro mapeado em memória, criando os vértices numa arena
+ * @param nomeFicheiro Nome do ficheiro a ler
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc)
+ * @return Apontador para a lista carregada
+ */
+Vertice* carregarAntenasMapeadoArena(const char* nomeFicheiro, ArenaGrafo* arena);
+
+/**
+ * @brief Cria a lista de antenas a partir do texto de um mapa em grelha já em memória
+ * @param dados Texto do mapa
+ * @param tamanho Número de bytes
+ * @param arena Arena onde são criados os vértices (NULL para usar malloc)
+ * @return Apontador para a lista carregada
+ */
+Vertice* lerGrelha(const char* dados, size_t tamanho, ArenaGrafo* arena);
+
+#endif
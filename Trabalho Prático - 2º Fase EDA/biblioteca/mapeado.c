@@ -0,0 +1,446 @@
+/**
+ * @file mapeado.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação do grafo de antenas consultado diretamente de um ficheiro mapeado em memória
+ * @version 0.1
+ * @date 2025-06-13
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mapeado.h"
+#include "efeitos.h"
+#include "intersecoes.h"
+#include "snapshot.h"
+
+/**
+ * @brief Secções do ficheiro, pela ordem em que são escritas.
+ */
+enum secaoMapeado {
+    SECAO_X,
+    SECAO_Y,
+    SECAO_FREQUENCIA,
+    SECAO_CHAVES,
+    SECAO_ORDEM,
+    SECAO_INICIO,
+    SECAO_VIZINHOS,
+    SECAO_EFEITOS,
+    SECAO_DIRECAO,
+    NUM_SECOES
+};
+
+/**
+ * @brief Chave de uma posição com o número do vértice ou o alinhamento do efeito (para ordenar).
+ */
+typedef struct chaveOrdenada {
+    uint64_t chave;
+    uint32_t valor;
+} ChaveOrdenada;
+
+#pragma region Bytes
+/**
+ * @brief Escreve um inteiro de 32 bits em little-endian, independentemente da máquina.
+ */
+static void escreverU32(unsigned char* p, uint32_t valor) {
+    for (int i = 0; i < 4; i++) p[i] = (unsigned char)(valor >> (8 * i));
+}
+
+/**
+ * @brief Escreve um inteiro de 64 bits em little-endian, independentemente da máquina.
+ */
+static void escreverU64(unsigned char* p, uint64_t valor) {
+    for (int i = 0; i < 8; i++) p[i] = (unsigned char)(valor >> (8 * i));
+}
+
+/**
+ * @brief Lê um inteiro de 32 bits escrito em little-endian.
+ */
+static uint32_t lerU32(const unsigned char* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief Lê um inteiro de 64 bits escrito em little-endian.
+ */
+static uint64_t lerU64(const unsigned char* p) {
+    return (uint64_t)lerU32(p) | ((uint64_t)lerU32(p + 4) << 32);
+}
+
+/**
+ * @brief Indica se a máquina guarda os inteiros em little-endian (a ordem do ficheiro).
+ */
+static int maquinaLittleEndian(void) {
+    const uint16_t um = 1;
+    return *(const unsigned char*)&um == 1;
+}
+
+/**
+ * @brief Arredonda uma posição para o múltiplo de 8 seguinte.
+ */
+static uint64_t alinhar(uint64_t posicao) {
+    return (posicao + 7) & ~(uint64_t)7;
+}
+
+/**
+ * @brief Número de bytes de cada secção.
+ */
+static void tamanhosSecoes(uint64_t numVertices, uint64_t numArestas, uint64_t numEfeitos, uint64_t* tamanhos) {
+    tamanhos[SECAO_X] = numVertices * 4;
+    tamanhos[SECAO_Y] = numVertices * 4;
+    tamanhos[SECAO_FREQUENCIA] = numVertices;
+    tamanhos[SECAO_CHAVES] = numVertices * 8;
+    tamanhos[SECAO_ORDEM] = numVertices * 4;
+    tamanhos[SECAO_INICIO] = (numVertices + 1) * 4;
+    tamanhos[SECAO_VIZINHOS] = numArestas * 4;
+    tamanhos[SECAO_EFEITOS] = numEfeitos * 8;
+    tamanhos[SECAO_DIRECAO] = numEfeitos;
+}
+
+/**
+ * @brief Compara chaves ordenadas pela chave e depois pelo valor (para o qsort).
+ */
+static int compararChavesOrdenadas(const void* a, const void* b) {
+    const ChaveOrdenada* p = (const ChaveOrdenada*)a;
+    const ChaveOrdenada* q = (const ChaveOrdenada*)b;
+    if (p->chave != q->chave) return p->chave < q->chave ? -1 : 1;
+    return (p->valor > q->valor) - (p->valor < q->valor);
+}
+
+/**
+ * @brief Ordena as chaves, a não ser que já estejam ordenadas (o caso da lista ordenada por (x, y)).
+ */
+static void ordenarChaves(ChaveOrdenada* chaves, size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        if (compararChavesOrdenadas(&chaves[i - 1], &chaves[i]) > 0) {
+            qsort(chaves, n, sizeof(ChaveOrdenada), compararChavesOrdenadas);
+            return;
+        }
+    }
+}
+#pragma endregion
+#pragma region Guardar Grafo Mapeado
+/**
+ * @brief Guarda a lista de antenas, as adjacências e os efeitos num ficheiro que pode ser consultado sem ser carregado.
+ *
+ * Os vértices são numerados pela ordem da lista (numerarVertices), como em
+ * guardarGrafoBinario, mas os dados ficam separados por secções (coordenadas,
+ * frequências, índice de posições, arestas em formato CSR e efeitos nefastos), cada
+ * uma alinhada a 8 bytes e com a posição guardada no cabeçalho. Assim, depois de
+ * mapeado, cada secção pode ser usada diretamente como vetor. O índice de posições e
+ * os efeitos (regra EFEITO_DISTANCIA_2) ficam ordenados por chavePosicao para serem
+ * procurados por pesquisa binária. Todo o conteúdo é preparado num único buffer e
+ * escrito com um só fwrite. As adjacências para vértices que não pertencem à lista
+ * são ignoradas.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param nomeFicheiro Nome do ficheiro a escrever (ex: "antenas.map").
+ * @return 0 em caso de sucesso, -1 em caso de erro.
+ */
+int guardarGrafoMapeado(Vertice* lista, const char* nomeFicheiro) {
+    if (!nomeFicheiro) return -1;
+    int numVertices = numerarVertices(lista);
+    Vertice** vertices = (Vertice**)malloc(((size_t)numVertices + 1) * sizeof(Vertice*));
+    ChaveOrdenada* chaves = (ChaveOrdenada*)malloc(((size_t)numVertices + 1) * sizeof(ChaveOrdenada));
+    ConjuntoEfeitos* efeitos = calcularEfeitos(lista, EFEITO_DISTANCIA_2);
+    ChaveOrdenada* chavesEfeitos = NULL;
+    if (efeitos) chavesEfeitos = (ChaveOrdenada*)malloc(((size_t)efeitos->total + 1) * sizeof(ChaveOrdenada));
+    if (!vertices || !chaves || !efeitos || !chavesEfeitos) {
+        printf("Erro ao alocar memória para o grafo mapeado!\n");
+        free(vertices);
+        free(chaves);
+        free(chavesEfeitos);
+        libertarConjuntoEfeitos(efeitos);
+        return -1;
+    }
+    // 1ª passagem: guardar os vértices por número e contar as arestas válidas
+    int i = 0;
+    for (Vertice* v = lista; v; v = v->prox) {
+        chaves[i].chave = chavePosicao(v->x, v->y);
+        chaves[i].valor = (uint32_t)i;
+        vertices[i++] = v;
+    }
+    uint64_t numArestas = 0;
+    for (Vertice* v = lista; v; v = v->prox) {
+        for (AdjD* adj = v->adjacencias; adj; adj = adj->next) {
+            Vertice* d = adj->destino;
+            if (d && d->id >= 0 && d->id < numVertices && vertices[d->id] == d) numArestas++;
+        }
+    }
+    int numEfeitos = efeitos->total;
+    for (i = 0; i < numEfeitos; i++) {
+        chavesEfeitos[i].chave = chavePosicao(efeitos->celulas[i].x, efeitos->celulas[i].y);
+        chavesEfeitos[i].valor = (unsigned char)efeitos->direcao[i];
+    }
+    libertarConjuntoEfeitos(efeitos);
+    ordenarChaves(chaves, (size_t)numVertices);
+    ordenarChaves(chavesEfeitos, (size_t)numEfeitos);
+
+    // Posição de cada secção
+    uint64_t tamanhos[NUM_SECOES], posicoes[NUM_SECOES];
+    tamanhosSecoes((uint64_t)numVertices, numArestas, (uint64_t)numEfeitos, tamanhos);
+    uint64_t tamanho = MAPEADO_CABECALHO;
+    for (int s = 0; s < NUM_SECOES; s++) {
+        posicoes[s] = alinhar(tamanho);
+        tamanho = posicoes[s] + tamanhos[s];
+    }
+    tamanho = alinhar(tamanho);
+    unsigned char* buffer = numArestas <= 0x7FFFFFFEu && tamanho <= (size_t)-1
+                          ? (unsigned char*)calloc(1, (size_t)tamanho) : NULL;
+    if (!buffer) {
+        printf("Erro ao alocar memória para o grafo mapeado!\n");
+        free(vertices);
+        free(chaves);
+        free(chavesEfeitos);
+        return -1;
+    }
+    // Vértices e índice de posições
+    for (i = 0; i < numVertices; i++) {
+        escreverU32(buffer + posicoes[SECAO_X] + (size_t)i * 4, (uint32_t)vertices[i]->x);
+        escreverU32(buffer + posicoes[SECAO_Y] + (size_t)i * 4, (uint32_t)vertices[i]->y);
+        buffer[posicoes[SECAO_FREQUENCIA] + (size_t)i] = (unsigned char)vertices[i]->frequencia;
+        escreverU64(buffer + posicoes[SECAO_CHAVES] + (size_t)i * 8, chaves[i].chave);
+        escreverU32(buffer + posicoes[SECAO_ORDEM] + (size_t)i * 4, chaves[i].valor);
+    }
+    // Arestas em formato CSR
+    unsigned char* inicio = buffer + posicoes[SECAO_INICIO];
+    unsigned char* vizinhos = buffer + posicoes[SECAO_VIZINHOS];
+    uint32_t total = 0;
+    for (i = 0; i < numVertices; i++) {
+        escreverU32(inicio + (size_t)i * 4, total);
+        for (AdjD* adj = vertices[i]->adjacencias; adj; adj = adj->next) {
+            Vertice* d = adj->destino;
+            if (d && d->id >= 0 && d->id < numVertices && vertices[d->id] == d) {
+                escreverU32(vizinhos + (size_t)total * 4, (uint32_t)d->id);
+                total++;
+            }
+        }
+    }
+    escreverU32(inicio + (size_t)numVertices * 4, total);
+    // Efeitos
+    for (i = 0; i < numEfeitos; i++) {
+        escreverU64(buffer + posicoes[SECAO_EFEITOS] + (size_t)i * 8, chavesEfeitos[i].chave);
+        buffer[posicoes[SECAO_DIRECAO] + (size_t)i] = (unsigned char)chavesEfeitos[i].valor;
+    }
+    free(vertices);
+    free(chaves);
+    free(chavesEfeitos);
+    // Cabeçalho
+    memcpy(buffer, MAPEADO_MAGICO, 4);
+    escreverU32(buffer + 4, MAPEADO_VERSAO);
+    escreverU32(buffer + 8, (uint32_t)numVertices);
+    escreverU32(buffer + 12, (uint32_t)numArestas);
+    escreverU32(buffer + 16, (uint32_t)numEfeitos);
+    escreverU32(buffer + 20, verificacaoSnapshot(buffer + MAPEADO_CABECALHO, (size_t)tamanho - MAPEADO_CABECALHO));
+    escreverU64(buffer + 24, tamanho);
+    for (int s = 0; s < NUM_SECOES; s++) {
+        escreverU64(buffer + 32 + (size_t)s * 8, posicoes[s]);
+    }
+
+    FILE* file = fopen(nomeFicheiro, "wb");
+    if (!file) {
+        free(buffer);
+        return -1;
+    }
+    size_t escritos = fwrite(buffer, 1, (size_t)tamanho, file);
+    free(buffer);
+    if (fclose(file) != 0 || escritos != (size_t)tamanho) {
+        return -1;
+    }
+    return 0;
+}
+#pragma endregion
+#pragma region Abrir Grafo Mapeado
+/**
+ * @brief Valida os índices guardados no ficheiro (só quando é pedida a verificação completa).
+ *
+ * @return 1 se o início das arestas for crescente e todos os números de vértice forem válidos, 0 caso contrário.
+ */
+static int indicesValidos(const GrafoMapeado* g) {
+    uint32_t n = (uint32_t)g->numVertices;
+    if (g->inicio[0] != 0 || g->inicio[n] != (uint32_t)g->numArestas) return 0;
+    for (uint32_t i = 0; i < n; i++) {
+        if (g->inicio[i] > g->inicio[i + 1] || g->ordem[i] >= n) return 0;
+        if (i > 0 && g->chaves[i - 1] > g->chaves[i]) return 0;
+    }
+    for (int e = 0; e < g->numArestas; e++) {
+        if (g->vizinhos[e] >= n) return 0;
+    }
+    for (int e = 1; e < g->numEfeitos; e++) {
+        if (g->efeitos[e - 1] >= g->efeitos[e]) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Mapeia um ficheiro guardado por guardarGrafoMapeado e usa-o diretamente, sem copiar nem reconstruir o grafo.
+ *
+ * O ficheiro é mapeado só para leitura (mapearFicheiro) e os vetores do GrafoMapeado
+ * apontam para as secções dentro do mapeamento, por isso abrir o grafo custa o mesmo
+ * qualquer que seja o seu tamanho: só são lidas as páginas que as consultas usarem, e
+ * as páginas ficam na cache do sistema, partilhadas por todos os processos que abrirem
+ * o mesmo ficheiro. São sempre validados o identificador, a versão, o tamanho do
+ * ficheiro e a posição e o alinhamento de cada secção. Com verificar a 1 também é
+ * validado o valor de verificação e todos os índices, o que obriga a ler o ficheiro
+ * todo; sem essa verificação o ficheiro é tratado como fiável, e as consultas só
+ * garantem que não leem fora das secções. Os vetores são usados tal como estão no
+ * ficheiro, por isso o formato só é aberto em máquinas little-endian.
+ *
+ * @param nomeFicheiro Nome do ficheiro a abrir (ex: "antenas.map").
+ * @param verificar 1 para validar também a verificação e os índices, 0 para validar só o cabeçalho.
+ * @return Apontador para o grafo mapeado (libertar com fecharGrafoMapeado), ou NULL se o ficheiro não existir ou for inválido.
+ */
+GrafoMapeado* abrirGrafoMapeado(const char* nomeFicheiro, int verificar) {
+    if (!nomeFicheiro) return NULL;
+    if (!maquinaLittleEndian()) {
+        printf("O grafo mapeado só pode ser aberto em máquinas little-endian!\n");
+        return NULL;
+    }
+    GrafoMapeado* g = (GrafoMapeado*)calloc(1, sizeof(GrafoMapeado));
+    if (!g) {
+        printf("Erro ao alocar memória para o grafo mapeado!\n");
+        return NULL;
+    }
+    if (!mapearFicheiro(nomeFicheiro, &g->ficheiro)) {
+        free(g);
+        return NULL;
+    }
+    const unsigned char* dados = (const unsigned char*)g->ficheiro.dados;
+    size_t tamanho = g->ficheiro.tamanho;
+    if (tamanho < MAPEADO_CABECALHO || ((uintptr_t)dados & 7) != 0 || memcmp(dados, MAPEADO_MAGICO, 4) != 0) {
+        printf("Ficheiro mapeado inválido!\n");
+        fecharGrafoMapeado(g);
+        return NULL;
+    }
+    if (lerU32(dados + 4) != MAPEADO_VERSAO) {
+        printf("Versão do ficheiro mapeado não suportada!\n");
+        fecharGrafoMapeado(g);
+        return NULL;
+    }
+    uint32_t numVertices = lerU32(dados + 8);
+    uint32_t numArestas = lerU32(dados + 12);
+    uint32_t numEfeitos = lerU32(dados + 16);
+    int valido = numVertices <= 0x7FFFFFFEu && numArestas <= 0x7FFFFFFEu && numEfeitos <= 0x7FFFFFFEu &&
+                 lerU64(dados + 24) == (uint64_t)tamanho;
+    // Cada secção tem de estar alinhada, depois do cabeçalho e dentro do ficheiro
+    uint64_t tamanhos[NUM_SECOES], posicoes[NUM_SECOES];
+    tamanhosSecoes(numVertices, numArestas, numEfeitos, tamanhos);
+    for (int s = 0; s < NUM_SECOES && valido; s++) {
+        posicoes[s] = lerU64(dados + 32 + (size_t)s * 8);
+        valido = posicoes[s] % 8 == 0 && posicoes[s] >= MAPEADO_CABECALHO &&
+                 posicoes[s] <= (uint64_t)tamanho && tamanhos[s] <= (uint64_t)tamanho - posicoes[s];
+    }
+    if (valido && verificar) {
+        valido = verificacaoSnapshot(dados + MAPEADO_CABECALHO, tamanho - MAPEADO_CABECALHO) == lerU32(dados + 20);
+    }
+    if (!valido) {
+        printf("Ficheiro mapeado inválido!\n");
+        fecharGrafoMapeado(g);
+        return NULL;
+    }
+    g->numVertices = (int)numVertices;
+    g->numArestas = (int)numArestas;
+    g->numEfeitos = (int)numEfeitos;
+    g->x = (const int32_t*)(dados + posicoes[SECAO_X]);
+    g->y = (const int32_t*)(dados + posicoes[SECAO_Y]);
+    g->frequencia = (const char*)(dados + posicoes[SECAO_FREQUENCIA]);
+    g->chaves = (const uint64_t*)(dados + posicoes[SECAO_CHAVES]);
+    g->ordem = (const uint32_t*)(dados + posicoes[SECAO_ORDEM]);
+    g->inicio = (const uint32_t*)(dados + posicoes[SECAO_INICIO]);
+    g->vizinhos = (const uint32_t*)(dados + posicoes[SECAO_VIZINHOS]);
+    g->efeitos = (const uint64_t*)(dados + posicoes[SECAO_EFEITOS]);
+    g->direcao = (const char*)(dados + posicoes[SECAO_DIRECAO]);
+    if (verificar && !indicesValidos(g)) {
+        printf("Ficheiro mapeado inválido!\n");
+        fecharGrafoMapeado(g);
+        return NULL;
+    }
+    return g;
+}
+#pragma endregion
+#pragma region Consultas
+/**
+ * @brief Posição da primeira chave >= chave num vetor ordenado (pesquisa binária).
+ */
+static int primeiraChave(const uint64_t* chaves, int n, uint64_t chave) {
+    int a = 0, b = n;
+    while (a < b) {
+        int m = a + (b - a) / 2;
+        if (chaves[m] < chave) {
+            a = m + 1;
+        } else {
+            b = m;
+        }
+    }
+    return a;
+}
+
+/**
+ * @brief Procura o primeiro vértice (pela ordem da lista) com as coordenadas indicadas.
+ *
+ * Pesquisa binária no índice de posições do ficheiro: só são lidas as páginas do
+ * índice percorridas pela pesquisa.
+ *
+ * @param g Grafo mapeado.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Número do vértice, ou -1 se não existir.
+ */
+int procurarVerticeMapeado(const GrafoMapeado* g, int x, int y) {
+    if (!g) return -1;
+    uint64_t chave = chavePosicao(x, y);
+    int i = primeiraChave(g->chaves, g->numVertices, chave);
+    if (i >= g->numVertices || g->chaves[i] != chave || g->ordem[i] >= (uint32_t)g->numVertices) return -1;
+    return (int)g->ordem[i];
+}
+
+/**
+ * @brief Dá acesso aos vizinhos de um vértice, diretamente no ficheiro mapeado.
+ *
+ * @param g Grafo mapeado.
+ * @param v Número do vértice.
+ * @param vizinhos Onde fica o apontador para o primeiro vizinho (os números dos vértices de destino, seguidos).
+ * @return Número de vizinhos, ou 0 se o vértice não existir.
+ */
+int vizinhosMapeado(const GrafoMapeado* g, int v, const uint32_t** vizinhos) {
+    if (vizinhos) *vizinhos = NULL;
+    if (!g || v < 0 || v >= g->numVertices) return 0;
+    uint32_t a = g->inicio[v];
+    uint32_t b = g->inicio[v + 1];
+    if (a > b || b > (uint32_t)g->numArestas) return 0;
+    if (vizinhos) *vizinhos = g->vizinhos + a;
+    return (int)(b - a);
+}
+
+/**
+ * @brief Indica se uma posição tem efeito nefasto (regra EFEITO_DISTANCIA_2), sem recalcular os efeitos.
+ *
+ * @param g Grafo mapeado.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Alinhamento que originou o efeito ('H' ou 'V'), ou 0 se a posição não for afetada.
+ */
+char efeitoMapeado(const GrafoMapeado* g, int x, int y) {
+    if (!g) return 0;
+    uint64_t chave = chavePosicao(x, y);
+    int i = primeiraChave(g->efeitos, g->numEfeitos, chave);
+    if (i >= g->numEfeitos || g->efeitos[i] != chave) return 0;
+    return g->direcao[i];
+}
+
+/**
+ * @brief Desfaz o mapeamento do ficheiro e liberta o grafo.
+ *
+ * @param g Grafo mapeado.
+ * @return 0 em caso de sucesso.
+ */
+int fecharGrafoMapeado(GrafoMapeado* g) {
+    if (!g) return 0;
+    desmapearFicheiro(&g->ficheiro);
+    free(g);
+    return 0;
+}
+#pragma endregion
@@ -0,0 +1,110 @@
+/**
+ * @file mapeado.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Grafo de antenas consultado diretamente de um ficheiro mapeado em memória, sem o reconstruir
+ * @version 0.1
+ * @date 2025-06-13
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef MAPEADO_H
+#define MAPEADO_H
+
+#include <stdint.h>
+#include "grafo.h"
+#include "leitura.h"
+
+/**
+ * Organização do ficheiro (inteiros em little-endian, cada secção alinhada a 8 bytes):
+ *
+ *   Cabeçalho   "ANTM", versão, número de vértices, de arestas e de efeitos, verificação (6 x 4 bytes),
+ *               tamanho do ficheiro e posição de cada secção a contar do início (10 x 8 bytes)
+ *   X, Y        coordenadas de cada vértice, pela ordem da lista (numVertices x 4 bytes cada)
+ *   Frequência  frequência de cada vértice (numVertices bytes)
+ *   Chaves      chavePosicao(x, y) de cada vértice, ordenadas (numVertices x 8 bytes)
+ *   Ordem       número do vértice de cada chave (numVertices x 4 bytes)
+ *   Início      posição do primeiro vizinho de cada vértice (numVertices + 1 inteiros)
+ *   Vizinhos    número do vértice de destino de cada aresta (numArestas inteiros)
+ *   Efeitos     chavePosicao das posições com efeito nefasto, ordenadas (numEfeitos x 8 bytes)
+ *   Direção     alinhamento que originou cada efeito (numEfeitos bytes)
+ *
+ * Como só há posições relativas ao início do ficheiro, o mesmo ficheiro pode ser mapeado
+ * em qualquer endereço e partilhado (só para leitura) por vários processos.
+ * A verificação é o FNV-1a de 32 bits de todos os bytes depois do cabeçalho.
+ */
+#define MAPEADO_MAGICO "ANTM"
+#define MAPEADO_VERSAO 1
+#define MAPEADO_CABECALHO 104
+
+/**
+ * @brief Grafo aberto de um ficheiro mapeado; os vetores apontam para dentro do ficheiro.
+ */
+typedef struct grafoMapeado {
+    FicheiroMapeado ficheiro;
+    int numVertices;
+    int numArestas;
+    int numEfeitos;
+    const int32_t* x;              // Coordenada X de cada vértice
+    const int32_t* y;              // Coordenada Y de cada vértice
+    const char* frequencia;        // Frequência de cada vértice
+    const uint64_t* chaves;        // Posições dos vértices, ordenadas
+    const uint32_t* ordem;         // Vértice de cada chave
+    const uint32_t* inicio;        // Vizinhos do vértice v: vizinhos[inicio[v]] .. vizinhos[inicio[v + 1] - 1]
+    const uint32_t* vizinhos;
+    const uint64_t* efeitos;       // Posições com efeito nefasto (regra EFEITO_DISTANCIA_2), ordenadas
+    const char* direcao;           // Alinhamento de cada efeito
+} GrafoMapeado;
+
+/**
+ * @brief Guarda a lista de antenas, as adjacências e os efeitos no formato mapeável
+ * @param lista Lista de antenas
+ * @param nomeFicheiro Nome do ficheiro a escrever
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int guardarGrafoMapeado(Vertice* lista, const char* nomeFicheiro);
+
+/**
+ * @brief Mapeia um ficheiro guardado por guardarGrafoMapeado, sem copiar nem reconstruir o grafo
+ * @param nomeFicheiro Nome do ficheiro
+ * @param verificar 1 para validar também a verificação e todos os índices (lê o ficheiro todo)
+ * @return Grafo mapeado, ou NULL se o ficheiro for inválido
+ */
+GrafoMapeado* abrirGrafoMapeado(const char* nomeFicheiro, int verificar);
+
+/**
+ * @brief Procura o primeiro vértice com as coordenadas indicadas
+ * @param g Grafo mapeado
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Número do vértice, ou -1 se não existir
+ */
+int procurarVerticeMapeado(const GrafoMapeado* g, int x, int y);
+
+/**
+ * @brief Dá acesso aos vizinhos de um vértice, diretamente no ficheiro
+ * @param g Grafo mapeado
+ * @param v Número do vértice
+ * @param vizinhos Onde fica o apontador para o primeiro vizinho
+ * @return Número de vizinhos (0 se o vértice não existir)
+ */
+int vizinhosMapeado(const GrafoMapeado* g, int v, const uint32_t** vizinhos);
+
+/**
+ * @brief Indica se uma posição tem efeito nefasto
+ * @param g Grafo mapeado
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Alinhamento que originou o efeito ('H' ou 'V'), ou 0 se a posição não for afetada
+ */
+char efeitoMapeado(const GrafoMapeado* g, int x, int y);
+
+/**
+ * @brief Desfaz o mapeamento e liberta o grafo
+ * @param g Grafo mapeado
+ * @return 0 em caso de sucesso
+ */
+int fecharGrafoMapeado(GrafoMapeado* g);
+
+#endif
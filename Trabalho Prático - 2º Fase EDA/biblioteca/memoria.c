@@ -0,0 +1,212 @@
+/**
+ * @file memoria.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da arena de memória para vértices e adjacências
+ * @version 0.1
+ * @date 2025-05-28
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "memoria.h"
+
+#define ARENA_BLOCO_INICIAL 1024       // Nós do primeiro bloco
+#define ARENA_BLOCO_MAXIMO (1 << 20)   // Limite de nós por bloco
+
+/**
+ * @brief Cabeçalho de cada bloco, com o alinhamento necessário para os nós que vêm a seguir.
+ */
+typedef union cabecalhoBloco {
+    BlocoArena bloco;
+    long double alinhamento;
+    void* apontador;
+} CabecalhoBloco;
+
+#pragma region Criar Arena
+/**
+ * @brief Cria uma arena vazia. Os blocos só são reservados quando forem precisos.
+ *
+ * @return Apontador para a arena, ou NULL em caso de erro de memória.
+ */
+ArenaGrafo* criarArena(void) {
+    ArenaGrafo* arena = (ArenaGrafo*)calloc(1, sizeof(ArenaGrafo));
+    if (!arena) {
+        printf("Erro ao alocar memória para a arena!\n");
+        return NULL;
+    }
+    arena->tamanhoBloco = ARENA_BLOCO_INICIAL;
+    return arena;
+}
+#pragma endregion
+#pragma region Reservar Bloco
+/**
+ * @brief Reserva um novo bloco para "quantidade" nós de "tamanhoNo" bytes.
+ *
+ * O tamanho dos blocos duplica a cada reserva até ARENA_BLOCO_MAXIMO nós,
+ * por isso um grafo com milhões de nós usa apenas algumas dezenas de blocos.
+ *
+ * @param arena Arena do grafo.
+ * @param tamanhoNo Tamanho de cada nó em bytes.
+ * @param quantidade Apontador para o número de nós reservados (saída).
+ * @return Apontador para o primeiro nó do bloco, ou NULL em caso de erro.
+ */
+static void* reservarBloco(ArenaGrafo* arena, size_t tamanhoNo, int* quantidade) {
+    int total = arena->tamanhoBloco;
+    size_t bytes = sizeof(CabecalhoBloco) + (size_t)total * tamanhoNo;
+    CabecalhoBloco* cabecalho = (CabecalhoBloco*)malloc(bytes);
+    if (!cabecalho) {
+        printf("Erro ao alocar memória para a arena!\n");
+        return NULL;
+    }
+    cabecalho->bloco.prox = arena->blocos;
+    cabecalho->bloco.tamanhoNo = tamanhoNo;
+    cabecalho->bloco.quantidade = total;
+    arena->blocos = &cabecalho->bloco;
+    arena->numBlocos++;
+    arena->bytes += bytes;
+    if (arena->tamanhoBloco < ARENA_BLOCO_MAXIMO) {
+        arena->tamanhoBloco *= 2;
+    }
+    *quantidade = total;
+    return (void*)(cabecalho + 1);
+}
+#pragma endregion
+#pragma region Criar Antena na Arena
+/**
+ * @brief Cria uma antena com os mesmos valores iniciais que criarAntena, mas dentro da arena.
+ *
+ * @param arena Arena do grafo (se for NULL a antena é criada com criarAntena).
+ * @param frequencia Carátere que representa a frequência da antena.
+ * @param x Coordenada X da antena.
+ * @param y Coordenada Y da antena.
+ * @return Apontador para a nova antena, ou NULL em caso de erro de memória.
+ */
+Vertice* criarAntenaArena(ArenaGrafo* arena, char frequencia, int x, int y) {
+    if (!arena) return criarAntena(frequencia, x, y);
+    if (arena->verticesRestantes == 0) {
+        arena->vertices = (Vertice*)reservarBloco(arena, sizeof(Vertice), &arena->verticesRestantes);
+        if (!arena->vertices) return NULL;
+    }
+    Vertice* nova = arena->vertices++;
+    arena->verticesRestantes--;
+    memset(nova, 0, sizeof(Vertice));
+    nova->frequencia = frequencia;
+    nova->x = x;
+    nova->y = y;
+    nova->id = -1;
+    nova->componente = -1;
+    return nova;
+}
+#pragma endregion
+#pragma region Criar Adjacência na Arena
+/**
+ * @brief Cria uma adjacência dentro da arena.
+ *
+ * @param arena Arena do grafo (se for NULL a adjacência é criada com criarAdjacencia).
+ * @param origem Apontador para o vértice de origem.
+ * @param destino Apontador para o vértice de destino.
+ * @return Apontador para a nova adjacência, ou NULL em caso de erro de memória.
+ */
+AdjD* criarAdjacenciaArena(ArenaGrafo* arena, Vertice* origem, Vertice* destino) {
+    AdjD* nova;
+    if (!arena) {
+        nova = criarAdjacencia(destino);
+    } else {
+        if (arena->adjacenciasRestantes == 0) {
+            arena->adjacencias = (AdjD*)reservarBloco(arena, sizeof(AdjD), &arena->adjacenciasRestantes);
+            if (!arena->adjacencias) return NULL;
+        }
+        nova = arena->adjacencias++;
+        arena->adjacenciasRestantes--;
+        nova->destino = destino;
+        nova->next = NULL;
+    }
+    if (nova) nova->origem = origem;
+    return nova;
+}
+#pragma endregion
+#pragma region Juntar Arenas
+/**
+ * @brief Passa todos os blocos de uma arena para outra, sem copiar nós.
+ *
+ * Usada quando cada thread cria nós na sua própria arena: no fim os blocos
+ * passam para a arena do grafo e são libertados com ela. Os nós livres que
+ * restavam na arena de origem ficam por usar.
+ *
+ * @param destino Arena que fica com os blocos.
+ * @param origem Arena a juntar (é libertada e deixa de ser válida).
+ * @return Número de blocos passados.
+ */
+int juntarArena(ArenaGrafo* destino, ArenaGrafo* origem) {
+    if (!destino || !origem || destino == origem) return 0;
+    int total = origem->numBlocos;
+    BlocoArena* ultimo = origem->blocos;
+    if (ultimo) {
+        while (ultimo->prox) {
+            ultimo = ultimo->prox;
+        }
+        ultimo->prox = destino->blocos;
+        destino->blocos = origem->blocos;
+    }
+    destino->numBlocos += origem->numBlocos;
+    destino->bytes += origem->bytes;
+    free(origem);
+    return total;
+}
+#pragma endregion
+#pragma region Verificar Arena
+/**
+ * @brief Verifica se todos os vértices da lista estão dentro de blocos de vértices da arena.
+ *
+ * Usada antes de criar adjacências na arena: uma adjacência da arena presa a um vértice
+ * criado com malloc não poderia ser libertada nem por libertarMemoria nem por libertarArena.
+ * O número de blocos cresce com o logaritmo do número de nós, por isso a verificação
+ * custa pouco em relação à construção do grafo.
+ *
+ * @param arena Arena do grafo.
+ * @param lista Apontador para o início da lista de vértices.
+ * @return 1 se todos os vértices pertencerem à arena, 0 caso contrário.
+ */
+int arenaContemLista(ArenaGrafo* arena, Vertice* lista) {
+    if (!arena) return 0;
+    for (Vertice* v = lista; v; v = v->prox) {
+        uintptr_t p = (uintptr_t)v;
+        int encontrado = 0;
+        for (BlocoArena* b = arena->blocos; b && !encontrado; b = b->prox) {
+            if (b->tamanhoNo != sizeof(Vertice)) continue;
+            uintptr_t inicio = (uintptr_t)((CabecalhoBloco*)b + 1);
+            encontrado = p >= inicio && p < inicio + (size_t)b->quantidade * sizeof(Vertice);
+        }
+        if (!encontrado) return 0;
+    }
+    return 1;
+}
+#pragma endregion
+#pragma region Libertar Arena
+/**
+ * @brief Liberta de uma vez todos os blocos da arena e a própria arena.
+ *
+ * Todos os vértices e adjacências criados na arena deixam de ser válidos.
+ *
+ * @param arena Arena do grafo.
+ * @return Número de blocos libertados.
+ */
+int libertarArena(ArenaGrafo* arena) {
+    if (!arena) return 0;
+    int total = 0;
+    BlocoArena* bloco = arena->blocos;
+    while (bloco) {
+        BlocoArena* temp = bloco;
+        bloco = bloco->prox;
+        free(temp);
+        total++;
+    }
+    free(arena);
+    return total;
+}
+#pragma endregion
@@ -0,0 +1,95 @@
+/**
+ * @file memoria.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Arena de memória para os vértices e adjacências de um grafo
+ * @version 0.1
+ * @date 2025-05-28
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <stddef.h>
+#include "grafo.h"
+
+/**
+ * @brief Bloco de memória da arena (vários nós do mesmo tipo seguidos).
+ */
+typedef struct blocoArena {
+    struct blocoArena* prox;     // Bloco reservado antes deste
+    size_t tamanhoNo;            // Tamanho de cada nó do bloco (sizeof(Vertice) ou sizeof(AdjD))
+    int quantidade;              // Número de nós do bloco
+} BlocoArena;
+
+/**
+ * @brief Arena que guarda os vértices e adjacências de um grafo.
+ *
+ * Os nós são retirados de blocos grandes reservados com malloc e só são libertados
+ * todos de uma vez por libertarArena. Os nós da arena não podem ser passados a
+ * free, removeAntena, removerAdjacencia ou libertarMemoria. A arena é dona do grafo
+ * inteiro: só são criadas adjacências na arena entre vértices da mesma arena
+ * (ver arenaContemLista), para que libertarArena liberte tudo.
+ */
+struct arenaGrafo {
+    BlocoArena* blocos;          // Todos os blocos reservados
+    Vertice* vertices;           // Próximo vértice livre do bloco atual
+    int verticesRestantes;       // Vértices livres no bloco atual
+    AdjD* adjacencias;           // Próxima adjacência livre do bloco atual
+    int adjacenciasRestantes;    // Adjacências livres no bloco atual
+    int tamanhoBloco;            // Número de nós do próximo bloco (cresce até um limite)
+    int numBlocos;               // Número de blocos reservados
+    size_t bytes;                // Total de memória reservada
+};
+
+/**
+ * @brief Cria uma arena vazia
+ * @return Apontador para a arena, ou NULL em caso de erro
+ */
+ArenaGrafo* criarArena(void);
+
+/**
+ * @brief Cria uma antena (vértice) na arena
+ * @param arena Arena do grafo (NULL para usar criarAntena)
+ * @param frequencia Frequência da antena
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Apontador para a nova antena, ou NULL em caso de erro
+ */
+Vertice* criarAntenaArena(ArenaGrafo* arena, char frequencia, int x, int y);
+
+/**
+ * @brief Cria uma adjacência na arena
+ * @param arena Arena do grafo (NULL para usar criarAdjacencia)
+ * @param origem Vértice de origem
+ * @param destino Vértice de destino
+ * @return Apontador para a nova adjacência, ou NULL em caso de erro
+ */
+AdjD* criarAdjacenciaArena(ArenaGrafo* arena, Vertice* origem, Vertice* destino);
+
+/**
+ * @brief Passa os blocos de uma arena para outra e liberta a arena de origem
+ * @param destino Arena que fica com os nós
+ * @param origem Arena a juntar (deixa de ser válida)
+ * @return Número de blocos passados
+ */
+int juntarArena(ArenaGrafo* destino, ArenaGrafo* origem);
+
+/**
+ * @brief Verifica se todos os vértices de uma lista foram criados na arena
+ * @param arena Arena do grafo
+ * @param lista Lista de vértices
+ * @return 1 se todos pertencerem à arena, 0 caso contrário
+ */
+int arenaContemLista(ArenaGrafo* arena, Vertice* lista);
+
+/**
+ * @brief Liberta de uma vez todos os vértices e adjacências da arena
+ * @param arena Arena do grafo
+ * @return Número de blocos libertados
+ */
+int libertarArena(ArenaGrafo* arena);
+
+#endif
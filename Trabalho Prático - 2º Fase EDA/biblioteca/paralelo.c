@@ -0,0 +1,180 @@
+/**
+ * @file paralelo.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação do conjunto de threads com roubo de trabalho
+ * @version 0.1
+ * @date 2025-05-31
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "paralelo.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Fila de tarefas de uma thread. A dona tira do início e as outras roubam do fim.
+ */
+typedef struct filaTrabalho {
+    pthread_mutex_t trinco;
+    int inicio;                  // Próxima tarefa da dona
+    int fim;                     // Fim (exclusivo) das tarefas por fazer
+} FilaTrabalho;
+
+/**
+ * @brief Estado partilhado por todas as threads de uma execução.
+ */
+typedef struct poolTrabalho {
+    FilaTrabalho* filas;
+    int numTrabalhadores;
+    FuncaoTarefa funcao;
+    void* contexto;
+} PoolTrabalho;
+
+/**
+ * @brief Argumento de cada thread.
+ */
+typedef struct argTrabalhador {
+    PoolTrabalho* pool;
+    int id;
+} ArgTrabalhador;
+
+#pragma region Processadores
+/**
+ * @brief Devolve o número de processadores disponíveis no sistema.
+ *
+ * @return Número de processadores (pelo menos 1).
+ */
+int numeroProcessadores(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+/**
+ * @brief Decide quantas threads usar numa operação paralela.
+ *
+ * @param pedidos Número pedido (0 ou negativo para usar todos os processadores).
+ * @return Número de threads a usar (pelo menos 1).
+ */
+int numeroTrabalhadores(int pedidos) {
+    return pedidos > 0 ? pedidos : numeroProcessadores();
+}
+#pragma endregion
+#pragma region Roubo de Trabalho
+/**
+ * @brief Tira uma tarefa de uma fila.
+ *
+ * @param f Fila de tarefas.
+ * @param roubar 0 para tirar do início (dona da fila), 1 para tirar do fim (roubo).
+ * @return Número da tarefa, ou -1 se a fila estiver vazia.
+ */
+static int tirarTarefa(FilaTrabalho* f, int roubar) {
+    int tarefa = -1;
+    pthread_mutex_lock(&f->trinco);
+    if (f->inicio < f->fim) {
+        tarefa = roubar ? --f->fim : f->inicio++;
+    }
+    pthread_mutex_unlock(&f->trinco);
+    return tarefa;
+}
+
+/**
+ * @brief Ciclo de cada thread: faz as tarefas da sua fila e depois rouba às outras.
+ *
+ * As tarefas são todas conhecidas no início, por isso quando nenhuma fila tem
+ * tarefas a thread pode terminar.
+ *
+ * @param arg Apontador para ArgTrabalhador.
+ * @return NULL.
+ */
+static void* trabalhador(void* arg) {
+    ArgTrabalhador* a = (ArgTrabalhador*)arg;
+    PoolTrabalho* pool = a->pool;
+    int n = pool->numTrabalhadores;
+    for (;;) {
+        int tarefa = tirarTarefa(&pool->filas[a->id], 0);
+        for (int k = 1; tarefa < 0 && k < n; k++) {
+            tarefa = tirarTarefa(&pool->filas[(a->id + k) % n], 1);
+        }
+        if (tarefa < 0) break;
+        pool->funcao(pool->contexto, tarefa, a->id);
+    }
+    return NULL;
+}
+#pragma endregion
+#pragma region Executar Tarefas
+/**
+ * @brief Executa um conjunto de tarefas independentes em várias threads.
+ *
+ * As tarefas são divididas em blocos seguidos, um por thread (tarefas vizinhas
+ * costumam usar dados vizinhos). Quando uma thread acaba o seu bloco rouba tarefas
+ * do fim dos blocos das outras, por isso tarefas de tamanhos muito diferentes
+ * (ex: frequências com muitas ou poucas antenas) ficam equilibradas.
+ * A thread que chama a função também trabalha. Se não for possível criar uma
+ * thread, as suas tarefas são roubadas pelas restantes.
+ *
+ * @param numTarefas Número de tarefas.
+ * @param funcao Função a executar para cada tarefa.
+ * @param contexto Dados passados a todas as tarefas.
+ * @param numTrabalhadores Número de threads (0 ou negativo para usar todos os processadores).
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+int executarTarefas(int numTarefas, FuncaoTarefa funcao, void* contexto, int numTrabalhadores) {
+    if (numTarefas <= 0 || !funcao) return 0;
+    int n = numeroTrabalhadores(numTrabalhadores);
+    if (n > numTarefas) n = numTarefas;
+    if (n == 1) {
+        for (int t = 0; t < numTarefas; t++) funcao(contexto, t, 0);
+        return 0;
+    }
+    PoolTrabalho pool;
+    pool.filas = (FilaTrabalho*)malloc((size_t)n * sizeof(FilaTrabalho));
+    pthread_t* threads = (pthread_t*)malloc((size_t)n * sizeof(pthread_t));
+    ArgTrabalhador* args = (ArgTrabalhador*)malloc((size_t)n * sizeof(ArgTrabalhador));
+    int* criada = (int*)calloc((size_t)n, sizeof(int));
+    if (!pool.filas || !threads || !args || !criada) {
+        printf("Erro ao alocar memória para as threads!\n");
+        free(pool.filas); free(threads); free(args); free(criada);
+        return -1;
+    }
+    pool.numTrabalhadores = n;
+    pool.funcao = funcao;
+    pool.contexto = contexto;
+    for (int i = 0; i < n; i++) {
+        pthread_mutex_init(&pool.filas[i].trinco, NULL);
+        pool.filas[i].inicio = (int)((long long)numTarefas * i / n);
+        pool.filas[i].fim = (int)((long long)numTarefas * (i + 1) / n);
+        args[i].pool = &pool;
+        args[i].id = i;
+    }
+    for (int i = 1; i < n; i++) {
+        criada[i] = pthread_create(&threads[i], NULL, trabalhador, &args[i]) == 0;
+    }
+    trabalhador(&args[0]);
+    for (int i = 1; i < n; i++) {
+        if (criada[i]) pthread_join(threads[i], NULL);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_mutex_destroy(&pool.filas[i].trinco);
+    }
+    free(pool.filas);
+    free(threads);
+    free(args);
+    free(criada);
+    return 0;
+}
+#pragma endregion
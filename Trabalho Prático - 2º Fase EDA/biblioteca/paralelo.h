@@ -0,0 +1,46 @@
+/**
+ * @file paralelo.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Conjunto de threads com roubo de trabalho para dividir operações sobre o grafo
+ * @version 0.1
+ * @date 2025-05-31
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PARALELO_H
+#define PARALELO_H
+
+/**
+ * @brief Função executada para cada tarefa
+ * @param contexto Dados partilhados por todas as tarefas
+ * @param tarefa Número da tarefa (0 a numTarefas - 1)
+ * @param trabalhador Número da thread que a executa (0 a numTrabalhadores - 1)
+ */
+typedef void (*FuncaoTarefa)(void* contexto, int tarefa, int trabalhador);
+
+/**
+ * @brief Devolve o número de processadores disponíveis
+ * @return Número de processadores (pelo menos 1)
+ */
+int numeroProcessadores(void);
+
+/**
+ * @brief Decide quantas threads usar
+ * @param pedidos Número pedido (0 ou negativo para usar todos os processadores)
+ * @return Número de threads a usar (pelo menos 1)
+ */
+int numeroTrabalhadores(int pedidos);
+
+/**
+ * @brief Executa numTarefas tarefas em paralelo e espera que terminem todas
+ * @param numTarefas Número de tarefas
+ * @param funcao Função a executar para cada tarefa
+ * @param contexto Dados passados a todas as tarefas
+ * @param numTrabalhadores Número de threads (a thread que chama também trabalha)
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+int executarTarefas(int numTarefas, FuncaoTarefa funcao, void* contexto, int numTrabalhadores);
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * @file posicoes.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da tabela de dispersão por posição (endereçamento aberto com sondagem linear)
+ * @version 0.1
+ * @date 2025-05-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "posicoes.h"
+
+#define POSICOES_CAPACIDADE_MINIMA 64
+
+#pragma region Dispersão
+/**
+ * @brief Calcula o valor de dispersão de uma posição (x, y).
+ *
+ * Mistura as duas coordenadas para que linhas e colunas consecutivas
+ * fiquem espalhadas pela tabela.
+ *
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Valor de dispersão (usar os bits de menor peso).
+ */
+unsigned int dispersaoPosicao(int x, int y) {
+    unsigned int h = (unsigned int)x * 0x9E3779B1u;
+    h ^= (unsigned int)y * 0x85EBCA77u;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    return h;
+}
+#pragma endregion
+#pragma region Iniciar Tabela
+/**
+ * @brief Prepara uma tabela vazia com capacidade para o número de posições indicado.
+ *
+ * A capacidade real é a menor potência de 2 que mantém a ocupação abaixo de 50%.
+ *
+ * @param t Tabela a preparar.
+ * @param capacidade Número de posições previsto (0 para o valor por omissão).
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+int iniciarTabelaPosicoes(TabelaPosicoes* t, int capacidade) {
+    int total = POSICOES_CAPACIDADE_MINIMA;
+    while (total < capacidade * 2) {
+        total *= 2;
+    }
+    t->entradas = (EntradaPosicao*)calloc((size_t)total, sizeof(EntradaPosicao));
+    t->capacidade = t->entradas ? total : 0;
+    t->ocupadas = 0;
+    return t->entradas != NULL;
+}
+#pragma endregion
+#pragma region Aumentar Tabela
+/**
+ * @brief Duplica a capacidade da tabela e volta a distribuir as entradas.
+ *
+ * @param t Tabela a aumentar.
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+static int aumentarTabela(TabelaPosicoes* t) {
+    int novaCapacidade = t->capacidade * 2;
+    EntradaPosicao* nova = (EntradaPosicao*)calloc((size_t)novaCapacidade, sizeof(EntradaPosicao));
+    if (!nova) return 0;
+    unsigned int mascara = (unsigned int)novaCapacidade - 1;
+    for (int i = 0; i < t->capacidade; i++) {
+        EntradaPosicao* e = &t->entradas[i];
+        if (!e->valor) continue;
+        unsigned int p = dispersaoPosicao(e->x, e->y) & mascara;
+        while (nova[p].valor) {
+            p = (p + 1) & mascara;
+        }
+        nova[p] = *e;
+    }
+    free(t->entradas);
+    t->entradas = nova;
+    t->capacidade = novaCapacidade;
+    return 1;
+}
+#pragma endregion
+#pragma region Procurar
+/**
+ * @brief Procura a entrada da posição (x, y).
+ *
+ * @param t Tabela.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Posição da entrada, ou -1 se a posição não estiver registada.
+ */
+static int entradaPosicao(const TabelaPosicoes* t, int x, int y) {
+    unsigned int mascara = (unsigned int)t->capacidade - 1;
+    unsigned int p = dispersaoPosicao(x, y) & mascara;
+    while (t->entradas[p].valor) {
+        if (t->entradas[p].x == x && t->entradas[p].y == y) {
+            return (int)p;
+        }
+        p = (p + 1) & mascara;
+    }
+    return -1;
+}
+
+/**
+ * @brief Procura o valor guardado na posição (x, y).
+ *
+ * @param t Tabela.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Valor guardado, ou NULL se a posição não existir.
+ */
+void* procurarPosicao(const TabelaPosicoes* t, int x, int y) {
+    if (!t || !t->entradas) return NULL;
+    int p = entradaPosicao(t, x, y);
+    return p < 0 ? NULL : t->entradas[p].valor;
+}
+#pragma endregion
+#pragma region Definir
+/**
+ * @brief Guarda o valor da posição (x, y), substituindo o anterior se existir.
+ *
+ * A tabela só cresce quando é acrescentada uma posição nova, por isso substituir
+ * o valor de uma posição que já existe nunca falha.
+ *
+ * @param t Tabela.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param valor Valor a guardar (diferente de NULL).
+ * @return 1 em caso de sucesso, 0 em caso de erro.
+ */
+int definirPosicao(TabelaPosicoes* t, int x, int y, void* valor) {
+    if (!t || !t->entradas || !valor) return 0;
+    int existente = entradaPosicao(t, x, y);
+    if (existente >= 0) {
+        t->entradas[existente].valor = valor;
+        return 1;
+    }
+    // Mantém a ocupação abaixo de 50% para as sondagens serem curtas
+    if ((t->ocupadas + 1) * 2 > t->capacidade && !aumentarTabela(t)) {
+        return 0;
+    }
+    unsigned int mascara = (unsigned int)t->capacidade - 1;
+    unsigned int p = dispersaoPosicao(x, y) & mascara;
+    while (t->entradas[p].valor) {
+        p = (p + 1) & mascara;
+    }
+    t->entradas[p].x = x;
+    t->entradas[p].y = y;
+    t->entradas[p].valor = valor;
+    t->ocupadas++;
+    return 1;
+}
+#pragma endregion
+#pragma region Retirar
+/**
+ * @brief Retira a posição (x, y) da tabela.
+ *
+ * Usa remoção com deslocamento para trás, por isso a tabela nunca
+ * acumula marcas de entradas apagadas.
+ *
+ * @param t Tabela.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return 1 se a posição foi retirada, 0 se não existia.
+ */
+int retirarPosicao(TabelaPosicoes* t, int x, int y) {
+    if (!t || !t->entradas) return 0;
+    int encontrada = entradaPosicao(t, x, y);
+    if (encontrada < 0) return 0;
+    unsigned int mascara = (unsigned int)t->capacidade - 1;
+    unsigned int livre = (unsigned int)encontrada;
+    unsigned int p = (livre + 1) & mascara;
+    // Puxa para trás as entradas seguintes que deixariam de ser encontradas
+    while (t->entradas[p].valor) {
+        unsigned int inicio = dispersaoPosicao(t->entradas[p].x, t->entradas[p].y) & mascara;
+        if (((p - inicio) & mascara) >= ((p - livre) & mascara)) {
+            t->entradas[livre] = t->entradas[p];
+            livre = p;
+        }
+        p = (p + 1) & mascara;
+    }
+    t->entradas[livre].valor = NULL;
+    t->ocupadas--;
+    return 1;
+}
+#pragma endregion
+#pragma region Libertar Tabela
+/**
+ * @brief Liberta as entradas da tabela. Os valores guardados não são libertados.
+ *
+ * @param t Tabela.
+ * @return 0 em caso de sucesso.
+ */
+int libertarTabelaPosicoes(TabelaPosicoes* t) {
+    if (!t) return 0;
+    free(t->entradas);
+    t->entradas = NULL;
+    t->capacidade = 0;
+    t->ocupadas = 0;
+    return 0;
+}
+#pragma endregion
@@ -0,0 +1,86 @@
+/**
+ * @file posicoes.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Tabela de dispersão indexada por posição (x, y), partilhada pelos índices das duas fases
+ * @version 0.1
+ * @date 2025-05-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Não depende das estruturas das antenas: cada entrada guarda um apontador genérico,
+ * por isso é usada tanto pelo índice da lista de Vertice (indice.h) como pelo índice
+ * da lista de Antena da 1.ª fase (funcoes.h).
+ */
+
+#ifndef POSICOES_H
+#define POSICOES_H
+
+/**
+ * @brief Entrada da tabela (endereçamento aberto).
+ */
+typedef struct entradaPosicao {
+    int x, y;                    // Posição
+    void* valor;                 // Valor guardado (NULL = entrada livre)
+} EntradaPosicao;
+
+/**
+ * @brief Tabela de dispersão com sondagem linear, sem marcas de entradas apagadas.
+ */
+typedef struct tabelaPosicoes {
+    EntradaPosicao* entradas;    // Entradas da tabela
+    int capacidade;              // Número de entradas (potência de 2)
+    int ocupadas;                // Número de posições registadas
+} TabelaPosicoes;
+
+/**
+ * @brief Calcula o valor de dispersão de uma posição
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Valor de dispersão
+ */
+unsigned int dispersaoPosicao(int x, int y);
+
+/**
+ * @brief Prepara uma tabela vazia
+ * @param t Tabela
+ * @param capacidade Número de posições previsto (0 para o valor por omissão)
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória
+ */
+int iniciarTabelaPosicoes(TabelaPosicoes* t, int capacidade);
+
+/**
+ * @brief Procura o valor guardado numa posição
+ * @param t Tabela
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return Valor guardado, ou NULL se a posição não existir
+ */
+void* procurarPosicao(const TabelaPosicoes* t, int x, int y);
+
+/**
+ * @brief Guarda (ou substitui) o valor de uma posição; substituir nunca falha
+ * @param t Tabela
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @param valor Valor a guardar (diferente de NULL)
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória
+ */
+int definirPosicao(TabelaPosicoes* t, int x, int y, void* valor);
+
+/**
+ * @brief Retira uma posição da tabela
+ * @param t Tabela
+ * @param x Coordenada X
+ * @param y Coordenada Y
+ * @return 1 se a posição foi retirada, 0 se não existia
+ */
+int retirarPosicao(TabelaPosicoes* t, int x, int y);
+
+/**
+ * @brief Liberta as entradas da tabela (não liberta os valores)
+ * @param t Tabela
+ * @return 0 em caso de sucesso
+ */
+int libertarTabelaPosicoes(TabelaPosicoes* t);
+
+#endif
@@ -0,0 +1,661 @@
+/**
+ * @file quadtree.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da quadtree de antenas
+ * @version 0.1
+ * @date 2025-06-04
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "quadtree.h"
+#include "indice.h"
+
+#define QUADTREE_FOLHA 8         // Antenas por folha antes de a dividir
+
+#pragma region Nos
+/**
+ * @brief Cria uma folha vazia que cobre o quadrado indicado.
+ */
+static NoQuadtree* criarNo(long long x0, long long y0, long long lado) {
+    NoQuadtree* no = (NoQuadtree*)calloc(1, sizeof(NoQuadtree));
+    if (!no) return NULL;
+    no->x0 = x0;
+    no->y0 = y0;
+    no->lado = lado;
+    no->folha = 1;
+    return no;
+}
+
+/**
+ * @brief Liberta um nó e todos os seus descendentes.
+ */
+static void libertarNo(NoQuadtree* no) {
+    if (!no) return;
+    for (int i = 0; i < 4; i++) libertarNo(no->filhos[i]);
+    free(no->antenas);
+    free(no);
+}
+
+/**
+ * @brief Verifica se a frequência existe na subárvore (0 aceita todas).
+ */
+static int temFrequencia(NoQuadtree* no, char frequencia) {
+    if (frequencia == 0) return 1;
+    unsigned char f = (unsigned char)frequencia;
+    return (no->frequencias[f >> 6] >> (f & 63)) & 1;
+}
+
+/**
+ * @brief Marca a frequência de uma antena no nó.
+ */
+static void marcarFrequencia(NoQuadtree* no, char frequencia) {
+    unsigned char f = (unsigned char)frequencia;
+    no->frequencias[f >> 6] |= 1ULL << (f & 63);
+}
+
+/**
+ * @brief Volta a calcular as frequências do nó a partir das antenas ou dos filhos (depois de uma remoção).
+ */
+static void recalcularFrequencias(NoQuadtree* no) {
+    memset(no->frequencias, 0, sizeof(no->frequencias));
+    if (no->folha) {
+        for (int i = 0; i < no->num; i++) marcarFrequencia(no, no->antenas[i]->frequencia);
+        return;
+    }
+    for (int i = 0; i < 4; i++) {
+        if (!no->filhos[i]) continue;
+        for (int k = 0; k < 4; k++) no->frequencias[k] |= no->filhos[i]->frequencias[k];
+    }
+}
+
+/**
+ * @brief Quadrante do nó onde fica o ponto (bit 0 = metade de cima em X, bit 1 = em Y).
+ */
+static int quadrante(NoQuadtree* no, int x, int y) {
+    long long metade = no->lado / 2;
+    return (x >= no->x0 + metade) | ((y >= no->y0 + metade) << 1);
+}
+
+/**
+ * @brief Verifica se o ponto está dentro do quadrado do nó.
+ */
+static int contemPonto(NoQuadtree* no, int x, int y) {
+    return x >= no->x0 && x < no->x0 + no->lado && y >= no->y0 && y < no->y0 + no->lado;
+}
+#pragma endregion
+#pragma region Inserir
+/**
+ * @brief Acrescenta uma antena ao vetor de uma folha.
+ */
+static int acrescentarFolha(NoQuadtree* no, Vertice* v) {
+    if (no->num == no->capacidade) {
+        int nova = no->capacidade ? no->capacidade * 2 : QUADTREE_FOLHA + 1;
+        Vertice** antenas = (Vertice**)realloc(no->antenas, (size_t)nova * sizeof(Vertice*));
+        if (!antenas) return 0;
+        no->antenas = antenas;
+        no->capacidade = nova;
+    }
+    no->antenas[no->num++] = v;
+    return 1;
+}
+
+static int inserirNo(NoQuadtree* no, Vertice* v);
+
+/**
+ * @brief Divide uma folha cheia em quadrantes.
+ *
+ * Não divide se todas as antenas estiverem na mesma célula (frequências diferentes),
+ * porque iriam todas para o mesmo quadrante.
+ */
+static int dividirFolha(NoQuadtree* no) {
+    int iguais = 1;
+    for (int i = 1; i < no->num && iguais; i++) {
+        iguais = no->antenas[i]->x == no->antenas[0]->x && no->antenas[i]->y == no->antenas[0]->y;
+    }
+    if (iguais || no->lado < 2) return 1;
+    Vertice** antenas = no->antenas;
+    int num = no->num;
+    no->antenas = NULL;
+    no->num = no->capacidade = 0;
+    no->folha = 0;
+    no->total = 0;
+    memset(no->frequencias, 0, sizeof(no->frequencias));
+    int ok = 1;
+    for (int i = 0; i < num && ok; i++) ok = inserirNo(no, antenas[i]);
+    free(antenas);
+    return ok;
+}
+
+/**
+ * @brief Insere uma antena num nó que contém as suas coordenadas.
+ */
+static int inserirNo(NoQuadtree* no, Vertice* v) {
+    no->total++;
+    marcarFrequencia(no, v->frequencia);
+    if (no->folha) {
+        if (!acrescentarFolha(no, v)) return 0;
+        return no->num <= QUADTREE_FOLHA ? 1 : dividirFolha(no);
+    }
+    int q = quadrante(no, v->x, v->y);
+    if (!no->filhos[q]) {
+        long long metade = no->lado / 2;
+        no->filhos[q] = criarNo(no->x0 + ((q & 1) ? metade : 0), no->y0 + ((q & 2) ? metade : 0), metade);
+        if (!no->filhos[q]) return 0;
+    }
+    return inserirNo(no->filhos[q], v);
+}
+
+/**
+ * @brief Aumenta a raiz (duplicando o lado) até cobrir o ponto.
+ *
+ * Uma raiz que ainda é folha só alarga o seu quadrado; uma raiz interna passa a ser
+ * um dos quadrantes da nova raiz.
+ */
+static int alargarRaiz(QuadtreeAntenas* q, int x, int y) {
+    while (!contemPonto(q->raiz, x, y)) {
+        NoQuadtree* antiga = q->raiz;
+        long long x0 = x < antiga->x0 ? antiga->x0 - antiga->lado : antiga->x0;
+        long long y0 = y < antiga->y0 ? antiga->y0 - antiga->lado : antiga->y0;
+        if (antiga->folha) {
+            antiga->x0 = x0;
+            antiga->y0 = y0;
+            antiga->lado *= 2;
+            continue;
+        }
+        NoQuadtree* raiz = criarNo(x0, y0, antiga->lado * 2);
+        if (!raiz) return 0;
+        raiz->folha = 0;
+        raiz->total = antiga->total;
+        memcpy(raiz->frequencias, antiga->frequencias, sizeof(raiz->frequencias));
+        raiz->filhos[(antiga->x0 != x0) | ((antiga->y0 != y0) << 1)] = antiga;
+        q->raiz = raiz;
+    }
+    return 1;
+}
+
+/**
+ * @brief Insere uma antena na quadtree.
+ *
+ * Se as coordenadas estiverem fora da zona coberta, a raiz cresce (duplicando o lado)
+ * até as cobrir, por isso a ordem de inserção não desequilibra a árvore: a profundidade
+ * depende só da distância entre antenas, O(log(lado / distância mínima)).
+ *
+ * @param q Quadtree.
+ * @param v Antena a inserir (as coordenadas não podem mudar enquanto estiver na quadtree).
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória.
+ */
+int inserirQuadtree(QuadtreeAntenas* q, Vertice* v) {
+    if (!q || !v) return 0;
+    if (!q->raiz) {
+        q->raiz = criarNo(v->x, v->y, 1);
+        if (!q->raiz) {
+            printf("Erro ao alocar memória para a quadtree!\n");
+            return 0;
+        }
+    }
+    if (!alargarRaiz(q, v->x, v->y) || !inserirNo(q->raiz, v)) {
+        printf("Erro ao alocar memória para a quadtree!\n");
+        return 0;
+    }
+    q->total++;
+    return 1;
+}
+#pragma endregion
+#pragma region Remover
+/**
+ * @brief Copia para uma folha as antenas de uma subárvore.
+ */
+static int recolherAntenas(NoQuadtree* no, NoQuadtree* folha) {
+    if (!no) return 1;
+    if (no->folha) {
+        for (int i = 0; i < no->num; i++) {
+            if (!acrescentarFolha(folha, no->antenas[i])) return 0;
+        }
+        return 1;
+    }
+    for (int i = 0; i < 4; i++) {
+        if (!recolherAntenas(no->filhos[i], folha)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Junta os filhos de um nó numa folha quando já cabem numa só.
+ */
+static void juntarFilhos(NoQuadtree* no) {
+    NoQuadtree folha = { 0 };
+    if (!recolherAntenas(no, &folha)) {
+        free(folha.antenas);    // Sem memória: a árvore fica como estava, continua correta
+        return;
+    }
+    for (int i = 0; i < 4; i++) {
+        libertarNo(no->filhos[i]);
+        no->filhos[i] = NULL;
+    }
+    no->folha = 1;
+    no->antenas = folha.antenas;
+    no->num = folha.num;
+    no->capacidade = folha.capacidade;
+}
+
+/**
+ * @brief Retira uma antena da subárvore de um nó.
+ */
+static int removerNo(NoQuadtree* no, Vertice* v) {
+    if (no->folha) {
+        for (int i = 0; i < no->num; i++) {
+            if (no->antenas[i] == v) {
+                no->antenas[i] = no->antenas[--no->num];
+                no->total--;
+                recalcularFrequencias(no);
+                return 1;
+            }
+        }
+        return 0;
+    }
+    int q = quadrante(no, v->x, v->y);
+    NoQuadtree* filho = no->filhos[q];
+    if (!filho || !removerNo(filho, v)) return 0;
+    no->total--;
+    if (filho->total == 0) {
+        libertarNo(filho);
+        no->filhos[q] = NULL;
+    }
+    if (no->total <= QUADTREE_FOLHA) juntarFilhos(no);
+    recalcularFrequencias(no);
+    return 1;
+}
+
+/**
+ * @brief Retira uma antena da quadtree.
+ *
+ * As folhas que ficam vazias são libertadas e os nós com poucas antenas voltam a ser
+ * folhas, por isso a árvore não fica com ramos vazios depois de muitas remoções.
+ *
+ * @param q Quadtree.
+ * @param v Antena a retirar (procurada pelo apontador, nas suas coordenadas).
+ * @return 1 se foi retirada, 0 se não estava na quadtree.
+ */
+int removerQuadtree(QuadtreeAntenas* q, Vertice* v) {
+    if (!q || !q->raiz || !v || !contemPonto(q->raiz, v->x, v->y)) return 0;
+    if (!removerNo(q->raiz, v)) return 0;
+    q->total--;
+    return 1;
+}
+#pragma endregion
+#pragma region Criar e Libertar
+/**
+ * @brief Cria uma quadtree vazia.
+ *
+ * @return Apontador para a quadtree, ou NULL em caso de erro de memória.
+ */
+QuadtreeAntenas* criarQuadtree(void) {
+    QuadtreeAntenas* q = (QuadtreeAntenas*)calloc(1, sizeof(QuadtreeAntenas));
+    if (!q) printf("Erro ao alocar memória para a quadtree!\n");
+    return q;
+}
+
+/**
+ * @brief Cria uma quadtree com todas as antenas de uma lista.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @return Apontador para a quadtree, ou NULL em caso de erro de memória.
+ */
+QuadtreeAntenas* construirQuadtree(Vertice* lista) {
+    QuadtreeAntenas* q = criarQuadtree();
+    if (!q) return NULL;
+    for (Vertice* v = lista; v; v = v->prox) {
+        if (!inserirQuadtree(q, v)) {
+            libertarQuadtree(q);
+            return NULL;
+        }
+    }
+    return q;
+}
+
+/**
+ * @brief Cria a quadtree de uma lista e associa-a ao índice de coordenadas.
+ *
+ * A partir daqui InsereAntenaIndexada e removeAntenaIndexada também atualizam a
+ * quadtree, que é libertada com o índice (libertarIndice).
+ *
+ * @param indice Índice de coordenadas da lista.
+ * @param lista Apontador para o início da lista de antenas.
+ * @return Quadtree associada, ou NULL em caso de erro.
+ */
+QuadtreeAntenas* ativarIndiceEspacial(IndiceAntenas* indice, Vertice* lista) {
+    if (!indice) return NULL;
+    if (indice->espacial) return indice->espacial;
+    indice->espacial = construirQuadtree(lista);
+    return indice->espacial;
+}
+
+/**
+ * @brief Liberta a quadtree. As antenas continuam na lista.
+ *
+ * @param q Quadtree a libertar.
+ * @return 0 em caso de sucesso.
+ */
+int libertarQuadtree(QuadtreeAntenas* q) {
+    if (!q) return 0;
+    libertarNo(q->raiz);
+    free(q);
+    return 0;
+}
+#pragma endregion
+#pragma region Resultados
+/**
+ * @brief Cria um resultado vazio.
+ */
+static ResultadoEspacial* criarResultado(int capacidade) {
+    ResultadoEspacial* r = (ResultadoEspacial*)calloc(1, sizeof(ResultadoEspacial));
+    if (!r) return NULL;
+    r->capacidade = capacidade > 0 ? capacidade : 16;
+    r->antenas = (Vertice**)malloc((size_t)r->capacidade * sizeof(Vertice*));
+    r->distancia2 = (long long*)malloc((size_t)r->capacidade * sizeof(long long));
+    if (!r->antenas || !r->distancia2) {
+        libertarResultadoEspacial(r);
+        return NULL;
+    }
+    return r;
+}
+
+/**
+ * @brief Acrescenta uma antena ao resultado, aumentando os vetores se for preciso.
+ */
+static int acrescentarResultado(ResultadoEspacial* r, Vertice* v, long long d2) {
+    if (r->num == r->capacidade) {
+        int nova = r->capacidade * 2;
+        Vertice** antenas = (Vertice**)realloc(r->antenas, (size_t)nova * sizeof(Vertice*));
+        if (!antenas) return 0;
+        r->antenas = antenas;
+        long long* distancia2 = (long long*)realloc(r->distancia2, (size_t)nova * sizeof(long long));
+        if (!distancia2) return 0;
+        r->distancia2 = distancia2;
+        r->capacidade = nova;
+    }
+    r->antenas[r->num] = v;
+    r->distancia2[r->num] = d2;
+    r->num++;
+    return 1;
+}
+
+/**
+ * @brief Liberta um resultado de pesquisa. As antenas não são libertadas.
+ *
+ * @param r Resultado a libertar.
+ * @return 0 em caso de sucesso.
+ */
+int libertarResultadoEspacial(ResultadoEspacial* r) {
+    if (!r) return 0;
+    free(r->antenas);
+    free(r->distancia2);
+    free(r);
+    return 0;
+}
+#pragma endregion
+#pragma region Retangulo e Raio
+/**
+ * @brief Quadrado da menor distância entre um ponto e o quadrado de um nó.
+ */
+static long long distancia2No(NoQuadtree* no, long long x, long long y) {
+    long long fimX = no->x0 + no->lado - 1, fimY = no->y0 + no->lado - 1;
+    long long dx = x < no->x0 ? no->x0 - x : (x > fimX ? x - fimX : 0);
+    long long dy = y < no->y0 ? no->y0 - y : (y > fimY ? y - fimY : 0);
+    return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Quadrado da distância entre uma antena e um ponto.
+ */
+static long long distancia2Antena(Vertice* v, long long x, long long y) {
+    long long dx = v->x - x, dy = v->y - y;
+    return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Recolhe as antenas de uma subárvore dentro do retângulo.
+ */
+static int retanguloNo(NoQuadtree* no, int x1, int y1, int x2, int y2, char frequencia, ResultadoEspacial* r) {
+    if (!no || !temFrequencia(no, frequencia)) return 1;
+    if (no->x0 > x2 || no->x0 + no->lado - 1 < x1 || no->y0 > y2 || no->y0 + no->lado - 1 < y1) return 1;
+    if (no->folha) {
+        for (int i = 0; i < no->num; i++) {
+            Vertice* v = no->antenas[i];
+            if (v->x >= x1 && v->x <= x2 && v->y >= y1 && v->y <= y2 &&
+                (frequencia == 0 || v->frequencia == frequencia)) {
+                if (!acrescentarResultado(r, v, 0)) return 0;
+            }
+        }
+        return 1;
+    }
+    for (int i = 0; i < 4; i++) {
+        if (!retanguloNo(no->filhos[i], x1, y1, x2, y2, frequencia, r)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Procura as antenas dentro de um retângulo.
+ *
+ * Só são visitados os nós cujo quadrado toca o retângulo e que têm a frequência
+ * pedida, por isso o custo depende do número de antenas encontradas e não do total.
+ *
+ * @param q Quadtree.
+ * @param x1 X mínimo (incluído).
+ * @param y1 Y mínimo (incluído).
+ * @param x2 X máximo (incluído).
+ * @param y2 Y máximo (incluído).
+ * @param frequencia Frequência a procurar, ou 0 para todas.
+ * @return Antenas encontradas (sem ordem definida), ou NULL em caso de erro.
+ */
+ResultadoEspacial* procurarRetangulo(QuadtreeAntenas* q, int x1, int y1, int x2, int y2, char frequencia) {
+    if (!q) return NULL;
+    ResultadoEspacial* r = criarResultado(0);
+    if (!r) {
+        printf("Erro ao alocar memória para a pesquisa!\n");
+        return NULL;
+    }
+    if (!retanguloNo(q->raiz, x1, y1, x2, y2, frequencia, r)) {
+        printf("Erro ao alocar memória para a pesquisa!\n");
+        libertarResultadoEspacial(r);
+        return NULL;
+    }
+    return r;
+}
+
+/**
+ * @brief Recolhe as antenas de uma subárvore dentro do círculo.
+ */
+static int raioNo(NoQuadtree* no, int x, int y, long long raio2, char frequencia, ResultadoEspacial* r) {
+    if (!no || !temFrequencia(no, frequencia) || distancia2No(no, x, y) > raio2) return 1;
+    if (no->folha) {
+        for (int i = 0; i < no->num; i++) {
+            Vertice* v = no->antenas[i];
+            long long d2 = distancia2Antena(v, x, y);
+            if (d2 <= raio2 && (frequencia == 0 || v->frequencia == frequencia)) {
+                if (!acrescentarResultado(r, v, d2)) return 0;
+            }
+        }
+        return 1;
+    }
+    for (int i = 0; i < 4; i++) {
+        if (!raioNo(no->filhos[i], x, y, raio2, frequencia, r)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Procura as antenas a uma distância euclidiana de (x, y) não superior ao raio.
+ *
+ * @param q Quadtree.
+ * @param x Coordenada X do ponto.
+ * @param y Coordenada Y do ponto.
+ * @param raio Raio da pesquisa (limite incluído).
+ * @param frequencia Frequência a procurar, ou 0 para todas.
+ * @return Antenas encontradas com o quadrado da distância (sem ordem definida), ou NULL em caso de erro.
+ */
+ResultadoEspacial* procurarRaio(QuadtreeAntenas* q, int x, int y, int raio, char frequencia) {
+    if (!q || raio < 0) return NULL;
+    ResultadoEspacial* r = criarResultado(0);
+    if (!r) {
+        printf("Erro ao alocar memória para a pesquisa!\n");
+        return NULL;
+    }
+    if (!raioNo(q->raiz, x, y, (long long)raio * raio, frequencia, r)) {
+        printf("Erro ao alocar memória para a pesquisa!\n");
+        libertarResultadoEspacial(r);
+        return NULL;
+    }
+    return r;
+}
+#pragma endregion
+#pragma region Mais Proximas
+/**
+ * @brief Candidato da pesquisa dos mais próximos.
+ */
+typedef struct candidatoEspacial {
+    long long d2;
+    Vertice* v;
+} CandidatoEspacial;
+
+/**
+ * @brief Ordem dos candidatos: distância, depois (x, y, frequência) para o resultado não depender da árvore.
+ */
+static int antesDe(const CandidatoEspacial* a, const CandidatoEspacial* b) {
+    if (a->d2 != b->d2) return a->d2 < b->d2;
+    if (a->v->x != b->v->x) return a->v->x < b->v->x;
+    if (a->v->y != b->v->y) return a->v->y < b->v->y;
+    return (unsigned char)a->v->frequencia < (unsigned char)b->v->frequencia;
+}
+
+/**
+ * @brief Estado da pesquisa: heap de máximo com os k melhores candidatos até agora.
+ */
+typedef struct pesquisaProximas {
+    CandidatoEspacial* heap;
+    int num, k;
+    int x, y;
+    char frequencia;
+} PesquisaProximas;
+
+/**
+ * @brief Tenta juntar um candidato ao heap (substitui o pior se o heap estiver cheio).
+ */
+static void oferecerCandidato(PesquisaProximas* p, CandidatoEspacial c) {
+    CandidatoEspacial* h = p->heap;
+    int i;
+    if (p->num < p->k) {
+        i = p->num++;
+        while (i > 0 && antesDe(&h[(i - 1) / 2], &c)) {
+            h[i] = h[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        h[i] = c;
+        return;
+    }
+    if (!antesDe(&c, &h[0])) return;
+    i = 0;
+    for (;;) {
+        int maior = 2 * i + 1;
+        if (maior >= p->num) break;
+        if (maior + 1 < p->num && antesDe(&h[maior], &h[maior + 1])) maior++;
+        if (!antesDe(&c, &h[maior])) break;
+        h[i] = h[maior];
+        i = maior;
+    }
+    h[i] = c;
+}
+
+/**
+ * @brief Pesquisa em profundidade, visitando primeiro os quadrantes mais perto do ponto
+ * e saltando os que estão mais longe do que o pior dos k candidatos.
+ */
+static void proximasNo(NoQuadtree* no, PesquisaProximas* p) {
+    if (!no || !temFrequencia(no, p->frequencia)) return;
+    if (p->num == p->k && distancia2No(no, p->x, p->y) > p->heap[0].d2) return;
+    if (no->folha) {
+        for (int i = 0; i < no->num; i++) {
+            Vertice* v = no->antenas[i];
+            if (p->frequencia != 0 && v->frequencia != p->frequencia) continue;
+            CandidatoEspacial c = { distancia2Antena(v, p->x, p->y), v };
+            oferecerCandidato(p, c);
+        }
+        return;
+    }
+    int ordem[4] = { 0, 1, 2, 3 };
+    long long d[4];
+    for (int i = 0; i < 4; i++) {
+        d[i] = no->filhos[i] ? distancia2No(no->filhos[i], p->x, p->y) : 0;
+    }
+    for (int i = 1; i < 4; i++) {
+        int o = ordem[i], j = i;
+        while (j > 0 && d[ordem[j - 1]] > d[o]) {
+            ordem[j] = ordem[j - 1];
+            j--;
+        }
+        ordem[j] = o;
+    }
+    for (int i = 0; i < 4; i++) proximasNo(no->filhos[ordem[i]], p);
+}
+
+/**
+ * @brief Procura as k antenas mais próximas de (x, y).
+ *
+ * Pesquisa "branch and bound": mantém os k melhores candidatos num heap de máximo e
+ * ignora os nós cuja distância mínima ao ponto já é maior do que a do pior candidato.
+ * Com filtro de frequência, os nós sem essa frequência são ignorados logo à entrada.
+ * Em caso de empate na distância fica primeiro a antena com menor (x, y).
+ *
+ * @param q Quadtree.
+ * @param x Coordenada X do ponto.
+ * @param y Coordenada Y do ponto.
+ * @param k Número de antenas pretendidas.
+ * @param frequencia Frequência a procurar, ou 0 para todas.
+ * @return Até k antenas por ordem crescente de distância, ou NULL em caso de erro.
+ */
+ResultadoEspacial* procurarMaisProximas(QuadtreeAntenas* q, int x, int y, int k, char frequencia) {
+    if (!q || k < 0) return NULL;
+    if (k > q->total) k = q->total;
+    ResultadoEspacial* r = criarResultado(k);
+    PesquisaProximas p = { NULL, 0, k, x, y, frequencia };
+    p.heap = (CandidatoEspacial*)malloc((size_t)(k > 0 ? k : 1) * sizeof(CandidatoEspacial));
+    if (!r || !p.heap) {
+        printf("Erro ao alocar memória para a pesquisa!\n");
+        libertarResultadoEspacial(r);
+        free(p.heap);
+        return NULL;
+    }
+    if (k > 0) proximasNo(q->raiz, &p);
+    // Retirar do heap o pior de cada vez, preenchendo o resultado de trás para a frente
+    r->num = p.num;
+    while (p.num > 0) {
+        CandidatoEspacial pior = p.heap[0];
+        CandidatoEspacial ultimo = p.heap[--p.num];
+        if (p.num > 0) {
+            p.heap[0] = ultimo;
+            // Descer o último a partir da raiz
+            int i = 0;
+            for (;;) {
+                int maior = 2 * i + 1;
+                if (maior >= p.num) break;
+                if (maior + 1 < p.num && antesDe(&p.heap[maior], &p.heap[maior + 1])) maior++;
+                if (!antesDe(&p.heap[i], &p.heap[maior])) break;
+                CandidatoEspacial t = p.heap[i];
+                p.heap[i] = p.heap[maior];
+                p.heap[maior] = t;
+                i = maior;
+            }
+        }
+        r->antenas[p.num] = pior.v;
+        r->distancia2[p.num] = pior.d2;
+    }
+    free(p.heap);
+    return r;
+}
+#pragma endregion
@@ -0,0 +1,137 @@
+/**
+ * @file quadtree.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Índice espacial (quadtree) para pesquisas por retângulo, raio e vizinhos mais próximos
+ * @version 0.1
+ * @date 2025-06-04
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef QUADTREE_H
+#define QUADTREE_H
+
+#include <stdint.h>
+#include "grafo.h"
+
+/**
+ * @brief Nó da quadtree: quadrado [x0, x0 + lado) x [y0, y0 + lado).
+ *
+ * Os nós internos têm até 4 filhos (NULL nos quadrantes vazios); as folhas guardam até QUADTREE_FOLHA antenas
+ * (mais, se estiverem todas na mesma célula).
+ */
+typedef struct noQuadtree {
+    long long x0, y0, lado;
+    int folha;                   // 1 se o nó guarda as antenas diretamente
+    int total;                   // Antenas na subárvore
+    uint64_t frequencias[4];     // Frequências presentes na subárvore (1 bit por caracter)
+    struct noQuadtree* filhos[4]; // NULL nas folhas
+    Vertice** antenas;           // Antenas da folha
+    int num, capacidade;
+} NoQuadtree;
+
+/**
+ * @brief Quadtree das antenas (a raiz cresce quando se insere fora da zona coberta).
+ */
+typedef struct quadtreeAntenas {
+    NoQuadtree* raiz;
+    int total;
+} QuadtreeAntenas;
+
+/**
+ * @brief Antenas encontradas por uma pesquisa espacial.
+ */
+typedef struct resultadoEspacial {
+    int num;
+    int capacidade;
+    Vertice** antenas;
+    long long* distancia2;       // Quadrado da distância ao ponto pesquisado (0 nos retângulos)
+} ResultadoEspacial;
+
+/**
+ * @brief Cria uma quadtree vazia
+ * @return Apontador para a quadtree, ou NULL em caso de erro
+ */
+QuadtreeAntenas* criarQuadtree(void);
+
+/**
+ * @brief Cria uma quadtree com todas as antenas de uma lista
+ * @param lista Lista de antenas
+ * @return Apontador para a quadtree, ou NULL em caso de erro
+ */
+QuadtreeAntenas* construirQuadtree(Vertice* lista);
+
+/**
+ * @brief Insere uma antena na quadtree
+ * @param q Quadtree
+ * @param v Antena a inserir
+ * @return 1 em caso de sucesso, 0 em caso de erro de memória
+ */
+int inserirQuadtree(QuadtreeAntenas* q, Vertice* v);
+
+/**
+ * @brief Retira uma antena da quadtree
+ * @param q Quadtree
+ * @param v Antena a retirar
+ * @return 1 se foi retirada, 0 se não estava na quadtree
+ */
+int removerQuadtree(QuadtreeAntenas* q, Vertice* v);
+
+/**
+ * @brief Associa uma quadtree ao índice de coordenadas (atualizada por InsereAntenaIndexada e removeAntenaIndexada)
+ * @param indice Índice de coordenadas
+ * @param lista Lista de antenas já registada no índice
+ * @return Quadtree criada, ou NULL em caso de erro
+ */
+QuadtreeAntenas* ativarIndiceEspacial(IndiceAntenas* indice, Vertice* lista);
+
+/**
+ * @brief Procura as antenas dentro de um retângulo (limites incluídos)
+ * @param q Quadtree
+ * @param x1 X mínimo
+ * @param y1 Y mínimo
+ * @param x2 X máximo
+ * @param y2 Y máximo
+ * @param frequencia Frequência a procurar (0 para todas)
+ * @return Antenas encontradas, ou NULL em caso de erro
+ */
+ResultadoEspacial* procurarRetangulo(QuadtreeAntenas* q, int x1, int y1, int x2, int y2, char frequencia);
+
+/**
+ * @brief Procura as antenas a uma distância (euclidiana) de um ponto não superior ao raio
+ * @param q Quadtree
+ * @param x Coordenada X do ponto
+ * @param y Coordenada Y do ponto
+ * @param raio Raio da pesquisa
+ * @param frequencia Frequência a procurar (0 para todas)
+ * @return Antenas encontradas, ou NULL em caso de erro
+ */
+ResultadoEspacial* procurarRaio(QuadtreeAntenas* q, int x, int y, int raio, char frequencia);
+
+/**
+ * @brief Procura as k antenas mais próximas de um ponto, por ordem de distância
+ * @param q Quadtree
+ * @param x Coordenada X do ponto
+ * @param y Coordenada Y do ponto
+ * @param k Número de antenas a procurar
+ * @param frequencia Frequência a procurar (0 para todas)
+ * @return Antenas encontradas (no máximo k), ou NULL em caso de erro
+ */
+ResultadoEspacial* procurarMaisProximas(QuadtreeAntenas* q, int x, int y, int k, char frequencia);
+
+/**
+ * @brief Liberta um resultado de pesquisa (não liberta as antenas)
+ * @param r Resultado
+ * @return 0 em caso de sucesso
+ */
+int libertarResultadoEspacial(ResultadoEspacial* r);
+
+/**
+ * @brief Liberta a quadtree (não liberta as antenas)
+ * @param q Quadtree
+ * @return 0 em caso de sucesso
+ */
+int libertarQuadtree(QuadtreeAntenas* q);
+
+#endif
@@ -0,0 +1,367 @@
+/**
+ * @file regras.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação das regras de efeitos nefastos e da passagem única pelos grupos de frequência
+ * @version 0.1
+ * @date 2025-06-09
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "regras.h"
+
+#pragma region Auxiliares
+/**
+ * @brief Compara coordenadas por (x, y).
+ */
+static int compararXY(const void* a, const void* b) {
+    const Coordenada* p = (const Coordenada*)a;
+    const Coordenada* q = (const Coordenada*)b;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    return (p->y > q->y) - (p->y < q->y);
+}
+
+/**
+ * @brief Compara coordenadas por (y, x).
+ */
+static int compararYX(const void* a, const void* b) {
+    const Coordenada* p = (const Coordenada*)a;
+    const Coordenada* q = (const Coordenada*)b;
+    if (p->y != q->y) return p->y < q->y ? -1 : 1;
+    return (p->x > q->x) - (p->x < q->x);
+}
+
+/**
+ * @brief Alinhamento de duas antenas a partir da diferença das suas coordenadas.
+ */
+static char direcaoPar(long long dx, long long dy) {
+    if (dx == 0) return DIRECAO_MESMO_X;
+    if (dy == 0) return DIRECAO_MESMO_Y;
+    return DIRECAO_DIAGONAL;
+}
+
+/**
+ * @brief Verifica se a posição (x, y) está dentro dos limites do mapa.
+ */
+static int dentroDosLimites(const LimitesMapa* limites, long long x, long long y) {
+    return x >= limites->xMin && x <= limites->xMax && y >= limites->yMin && y <= limites->yMax;
+}
+#pragma endregion
+#pragma region Kernels
+/**
+ * @brief Regra EFEITO_DISTANCIA_2: antenas na mesma coluna ou linha a exatamente 2 posições.
+ *
+ * Nos vetores ordenados as antenas da mesma coluna (porX) e da mesma linha (porY) estão
+ * seguidas, por isso basta olhar para as antenas seguintes até 2 posições à frente.
+ * Uma posição originada nas duas direções (mesmo noutra frequência) fica "Horizontal",
+ * como em calcularEfeitos.
+ *
+ * @param grupo Antenas da frequência.
+ * @param limites Limites do mapa (não usados: a posição fica sempre entre as duas antenas).
+ * @param c Conjunto onde são acrescentadas as posições.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int kernelDistancia2(const GrupoFrequencia* grupo, const LimitesMapa* limites, ConjuntoEfeitos* c) {
+    (void)limites;
+    const Coordenada* v = grupo->porY;
+    for (int i = 0; i < grupo->num; i++) {
+        for (int k = i + 1; k < grupo->num && v[k].y == v[i].y && v[k].x <= v[i].x + 2; k++) {
+            if (v[k].x != v[i].x + 2) continue;
+            int res = adicionarEfeito(c, v[i].x + 1, v[i].y, DIRECAO_MESMO_Y);
+            if (res < 0) return -1;
+            // Já encontrada na vertical (numa frequência anterior): passa a "Horizontal"
+            if (res == 0) alterarDirecaoEfeito(c, v[i].x + 1, v[i].y, DIRECAO_MESMO_Y);
+        }
+    }
+    v = grupo->porX;
+    for (int i = 0; i < grupo->num; i++) {
+        for (int k = i + 1; k < grupo->num && v[k].x == v[i].x && v[k].y <= v[i].y + 2; k++) {
+            if (v[k].y == v[i].y + 2 && adicionarEfeito(c, v[i].x, v[i].y + 1, DIRECAO_MESMO_X) < 0) return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Regra EFEITO_DISTANCIA_PAR: ponto médio de antenas na mesma coluna ou linha a distância par.
+ *
+ * Cada antena só é comparada com as antenas seguintes da sua linha (porY) e da sua coluna (porX).
+ * Tal como em kernelDistancia2, uma posição originada nas duas direções fica "Horizontal".
+ *
+ * @param grupo Antenas da frequência.
+ * @param limites Limites do mapa (não usados).
+ * @param c Conjunto onde são acrescentadas as posições.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int kernelDistanciaPar(const GrupoFrequencia* grupo, const LimitesMapa* limites, ConjuntoEfeitos* c) {
+    (void)limites;
+    const Coordenada* v = grupo->porY;
+    for (int i = 0; i < grupo->num; i++) {
+        for (int k = i + 1; k < grupo->num && v[k].y == v[i].y; k++) {
+            long long dx = (long long)v[k].x - v[i].x;
+            if (dx % 2 != 0) continue;
+            int res = adicionarEfeito(c, (int)(v[i].x + dx / 2), v[i].y, DIRECAO_MESMO_Y);
+            if (res < 0) return -1;
+            // Já encontrada na vertical (numa frequência anterior): passa a "Horizontal"
+            if (res == 0) alterarDirecaoEfeito(c, (int)(v[i].x + dx / 2), v[i].y, DIRECAO_MESMO_Y);
+        }
+    }
+    v = grupo->porX;
+    for (int i = 0; i < grupo->num; i++) {
+        for (int k = i + 1; k < grupo->num && v[k].x == v[i].x; k++) {
+            long long dy = (long long)v[k].y - v[i].y;
+            if (dy % 2 == 0 && adicionarEfeito(c, v[i].x, (int)(v[i].y + dy / 2), DIRECAO_MESMO_X) < 0) return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Regra REGRA_COLINEAR: ponto médio de duas antenas em qualquer direção.
+ *
+ * Generaliza EFEITO_DISTANCIA_PAR às diagonais e às outras inclinações: o ponto médio é
+ * uma posição do mapa quando as duas diferenças (dx e dy) são pares. Compara todos os
+ * pares do grupo.
+ *
+ * @param grupo Antenas da frequência.
+ * @param limites Limites do mapa (não usados: o ponto médio fica sempre entre as antenas).
+ * @param c Conjunto onde são acrescentadas as posições.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int kernelColinear(const GrupoFrequencia* grupo, const LimitesMapa* limites, ConjuntoEfeitos* c) {
+    (void)limites;
+    const Coordenada* v = grupo->porX;
+    for (int i = 0; i < grupo->num; i++) {
+        for (int k = i + 1; k < grupo->num; k++) {
+            long long dx = (long long)v[k].x - v[i].x;
+            long long dy = (long long)v[k].y - v[i].y;
+            if (dx % 2 != 0 || dy % 2 != 0) continue;
+            if (adicionarEfeito(c, (int)(v[i].x + dx / 2), (int)(v[i].y + dy / 2), direcaoPar(dx, dy)) < 0) return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Regra REGRA_ANTINODOS: posições para lá de cada antena do par, à mesma distância.
+ *
+ * Para as antenas a e b as posições são 2a - b e 2b - a, desde que fiquem dentro dos limites.
+ *
+ * @param grupo Antenas da frequência.
+ * @param limites Limites do mapa.
+ * @param c Conjunto onde são acrescentadas as posições.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int kernelAntinodos(const GrupoFrequencia* grupo, const LimitesMapa* limites, ConjuntoEfeitos* c) {
+    const Coordenada* v = grupo->porX;
+    for (int i = 0; i < grupo->num; i++) {
+        for (int k = i + 1; k < grupo->num; k++) {
+            long long dx = (long long)v[k].x - v[i].x;
+            long long dy = (long long)v[k].y - v[i].y;
+            char direcao = direcaoPar(dx, dy);
+            if (dentroDosLimites(limites, v[i].x - dx, v[i].y - dy) &&
+                adicionarEfeito(c, (int)(v[i].x - dx), (int)(v[i].y - dy), direcao) < 0) return -1;
+            if (dentroDosLimites(limites, v[k].x + dx, v[k].y + dy) &&
+                adicionarEfeito(c, (int)(v[k].x + dx), (int)(v[k].y + dy), direcao) < 0) return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Regra REGRA_HARMONICOS: todas as posições a + k(b - a), com k inteiro, dentro dos limites.
+ *
+ * Inclui as próprias antenas (k = 0 e k = 1) e os antinodos (k = -1 e k = 2).
+ *
+ * @param grupo Antenas da frequência.
+ * @param limites Limites do mapa.
+ * @param c Conjunto onde são acrescentadas as posições.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+static int kernelHarmonicos(const GrupoFrequencia* grupo, const LimitesMapa* limites, ConjuntoEfeitos* c) {
+    const Coordenada* v = grupo->porX;
+    for (int i = 0; i < grupo->num; i++) {
+        for (int k = i + 1; k < grupo->num; k++) {
+            long long dx = (long long)v[k].x - v[i].x;
+            long long dy = (long long)v[k].y - v[i].y;
+            if (dx == 0 && dy == 0) continue;  // Antenas repetidas não definem uma reta
+            char direcao = direcaoPar(dx, dy);
+            // Para trás a partir de a (k <= 0) e para a frente a partir de b (k >= 1)
+            for (long long x = v[i].x, y = v[i].y; dentroDosLimites(limites, x, y); x -= dx, y -= dy) {
+                if (adicionarEfeito(c, (int)x, (int)y, direcao) < 0) return -1;
+            }
+            for (long long x = v[k].x, y = v[k].y; dentroDosLimites(limites, x, y); x += dx, y += dy) {
+                if (adicionarEfeito(c, (int)x, (int)y, direcao) < 0) return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Kernels compilados, pela ordem de TipoRegra.
+ */
+static const KernelRegra kernelsCompilados[NUM_REGRAS] = {
+    kernelDistancia2,
+    kernelDistanciaPar,
+    kernelColinear,
+    kernelAntinodos,
+    kernelHarmonicos
+};
+
+/**
+ * @brief Devolve o kernel compilado de uma regra.
+ *
+ * @param regra Regra.
+ * @return Kernel da regra, ou NULL se a regra não existir.
+ */
+KernelRegra kernelDaRegra(TipoRegra regra) {
+    if ((int)regra < 0 || regra >= NUM_REGRAS) return NULL;
+    return kernelsCompilados[regra];
+}
+#pragma endregion
+#pragma region Aplicar Regras
+/**
+ * @brief Calcula o menor retângulo que contém todas as antenas da lista.
+ *
+ * Com a lista vazia os limites ficam vazios (xMin > xMax).
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param limites Limites a preencher.
+ * @return Número de antenas da lista.
+ */
+int limitesDaLista(Vertice* lista, LimitesMapa* limites) {
+    int n = 0;
+    limites->xMin = limites->yMin = INT_MAX;
+    limites->xMax = limites->yMax = INT_MIN;
+    for (Vertice* v = lista; v; v = v->prox, n++) {
+        if (v->x < limites->xMin) limites->xMin = v->x;
+        if (v->x > limites->xMax) limites->xMax = v->x;
+        if (v->y < limites->yMin) limites->yMin = v->y;
+        if (v->y > limites->yMax) limites->yMax = v->y;
+    }
+    return n;
+}
+
+/**
+ * @brief Aplica vários kernels numa só passagem pelos grupos de frequência.
+ *
+ * As antenas são separadas por frequência (ordenação por contagem) e cada grupo é ordenado
+ * por (x, y) e por (y, x) uma única vez. Todos os kernels são depois aplicados ao grupo
+ * antes de passar ao seguinte, por isso várias regras partilham o agrupamento e a ordenação
+ * em vez de voltarem a percorrer a lista. Cada kernel tem o seu conjunto de resultados;
+ * as posições ficam agrupadas por frequência (pela ordem dos códigos das frequências).
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param kernels Kernels a aplicar.
+ * @param numKernels Número de kernels.
+ * @param limites Limites do mapa (NULL para usar os limites das antenas).
+ * @param resultados Vetor com numKernels posições onde fica o conjunto de cada kernel.
+ * @return 0 em caso de sucesso, -1 em caso de erro (nenhum conjunto fica reservado).
+ */
+int aplicarKernels(Vertice* lista, const KernelRegra* kernels, int numKernels,
+                   const LimitesMapa* limites, ConjuntoEfeitos** resultados) {
+    if (!kernels || !resultados || numKernels <= 0) return -1;
+    LimitesMapa limitesLista;
+    int n = limitesDaLista(lista, &limitesLista);
+    if (!limites) limites = &limitesLista;
+
+    int erro = 0;
+    for (int r = 0; r < numKernels; r++) {
+        resultados[r] = kernels[r] ? criarConjuntoEfeitos(n) : NULL;
+        if (!resultados[r]) erro = 1;
+    }
+    Coordenada* porX = (Coordenada*)malloc((n > 0 ? n : 1) * sizeof(Coordenada));
+    Coordenada* porY = (Coordenada*)malloc((n > 0 ? n : 1) * sizeof(Coordenada));
+    if (!porX || !porY) {
+        printf("Erro ao alocar memória para as regras!\n");
+        erro = 1;
+    }
+
+    if (!erro) {
+        // Separar por frequência
+        int inicio[257];
+        int livre[256];
+        memset(inicio, 0, sizeof(inicio));
+        for (Vertice* v = lista; v; v = v->prox) {
+            inicio[(unsigned char)v->frequencia + 1]++;
+        }
+        for (int f = 0; f < 256; f++) {
+            inicio[f + 1] += inicio[f];
+        }
+        memcpy(livre, inicio, sizeof(livre));
+        for (Vertice* v = lista; v; v = v->prox) {
+            Coordenada* p = &porX[livre[(unsigned char)v->frequencia]++];
+            p->x = v->x;
+            p->y = v->y;
+        }
+        memcpy(porY, porX, (size_t)n * sizeof(Coordenada));
+
+        for (int f = 0; f < 256 && !erro; f++) {
+            int num = inicio[f + 1] - inicio[f];
+            if (num < 2) continue;  // Uma antena sozinha não forma pares
+            GrupoFrequencia grupo;
+            grupo.frequencia = (char)f;
+            grupo.num = num;
+            grupo.porX = porX + inicio[f];
+            grupo.porY = porY + inicio[f];
+            qsort(porX + inicio[f], (size_t)num, sizeof(Coordenada), compararXY);
+            qsort(porY + inicio[f], (size_t)num, sizeof(Coordenada), compararYX);
+            for (int r = 0; r < numKernels && !erro; r++) {
+                erro = kernels[r](&grupo, limites, resultados[r]) < 0;
+            }
+        }
+        if (erro) printf("Erro ao alocar memória para os efeitos!\n");
+    }
+    free(porX);
+    free(porY);
+    if (erro) {
+        for (int r = 0; r < numKernels; r++) {
+            libertarConjuntoEfeitos(resultados[r]);
+            resultados[r] = NULL;
+        }
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Aplica várias regras (kernels compilados) numa só passagem pelos grupos de frequência.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param regras Regras a aplicar.
+ * @param numRegras Número de regras (no máximo NUM_REGRAS).
+ * @param limites Limites do mapa (NULL para usar os limites das antenas).
+ * @param resultados Vetor com numRegras posições onde fica o conjunto de cada regra.
+ * @return 0 em caso de sucesso, -1 em caso de erro.
+ */
+int aplicarRegras(Vertice* lista, const TipoRegra* regras, int numRegras,
+                  const LimitesMapa* limites, ConjuntoEfeitos** resultados) {
+    if (!regras || numRegras <= 0 || numRegras > NUM_REGRAS) return -1;
+    KernelRegra escolhidos[NUM_REGRAS];
+    for (int r = 0; r < numRegras; r++) {
+        escolhidos[r] = kernelDaRegra(regras[r]);
+        if (!escolhidos[r]) return -1;
+    }
+    return aplicarKernels(lista, escolhidos, numRegras, limites, resultados);
+}
+
+/**
+ * @brief Aplica uma só regra a todas as frequências.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param regra Regra a aplicar.
+ * @param limites Limites do mapa (NULL para usar os limites das antenas).
+ * @return Conjunto com as posições afetadas, ou NULL em caso de erro.
+ */
+ConjuntoEfeitos* aplicarRegra(Vertice* lista, TipoRegra regra, const LimitesMapa* limites) {
+    ConjuntoEfeitos* resultado = NULL;
+    if (aplicarRegras(lista, &regra, 1, limites, &resultado) < 0) return NULL;
+    return resultado;
+}
+#pragma endregion
@@ -0,0 +1,105 @@
+/**
+ * @file regras.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Regras de efeitos nefastos como funções (kernels) aplicadas a cada grupo de frequência
+ * @version 0.1
+ * @date 2025-06-09
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef REGRAS_H
+#define REGRAS_H
+
+#include "grafo.h"
+#include "efeitos.h"
+
+/**
+ * @brief Regras de efeitos nefastos disponíveis.
+ */
+typedef enum tipoRegra {
+    REGRA_DISTANCIA_2 = EFEITO_DISTANCIA_2,     // Mesma linha ou coluna, a exatamente 2 posições
+    REGRA_DISTANCIA_PAR = EFEITO_DISTANCIA_PAR, // Mesma linha ou coluna, a uma distância par
+    REGRA_COLINEAR,                             // Ponto médio de duas antenas em qualquer direção
+    REGRA_ANTINODOS,                            // Posições para lá de cada antena, à mesma distância
+    REGRA_HARMONICOS,                           // Todas as posições da reta a múltiplos da distância
+    NUM_REGRAS
+} TipoRegra;
+
+/**
+ * @brief Limites do mapa (inclusivos), usados pelas regras que produzem posições fora do par.
+ */
+typedef struct limitesMapa {
+    int xMin, yMin;
+    int xMax, yMax;
+} LimitesMapa;
+
+/**
+ * @brief Antenas de uma frequência, ordenadas de duas maneiras.
+ */
+typedef struct grupoFrequencia {
+    char frequencia;
+    int num;                     // Número de antenas do grupo
+    const Coordenada* porX;      // Ordenadas por (x, y): as da mesma coluna ficam seguidas
+    const Coordenada* porY;      // Ordenadas por (y, x): as da mesma linha ficam seguidas
+} GrupoFrequencia;
+
+/**
+ * @brief Função que aplica uma regra às antenas de um grupo de frequência
+ * @param grupo Antenas da frequência
+ * @param limites Limites do mapa
+ * @param c Conjunto onde são acrescentadas as posições afetadas
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+typedef int (*KernelRegra)(const GrupoFrequencia* grupo, const LimitesMapa* limites, ConjuntoEfeitos* c);
+
+/**
+ * @brief Devolve o kernel compilado de uma regra
+ * @param regra Regra
+ * @return Kernel da regra, ou NULL se a regra não existir
+ */
+KernelRegra kernelDaRegra(TipoRegra regra);
+
+/**
+ * @brief Calcula os limites das posições das antenas da lista
+ * @param lista Lista de antenas
+ * @param limites Limites a preencher
+ * @return Número de antenas da lista
+ */
+int limitesDaLista(Vertice* lista, LimitesMapa* limites);
+
+/**
+ * @brief Aplica vários kernels numa só passagem pelos grupos de frequência
+ * @param lista Lista de antenas
+ * @param kernels Kernels a aplicar
+ * @param numKernels Número de kernels
+ * @param limites Limites do mapa (NULL para usar os limites das antenas)
+ * @param resultados Vetor onde fica o conjunto de cada kernel
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int aplicarKernels(Vertice* lista, const KernelRegra* kernels, int numKernels,
+                   const LimitesMapa* limites, ConjuntoEfeitos** resultados);
+
+/**
+ * @brief Aplica várias regras numa só passagem pelos grupos de frequência
+ * @param lista Lista de antenas
+ * @param regras Regras a aplicar
+ * @param numRegras Número de regras
+ * @param limites Limites do mapa (NULL para usar os limites das antenas)
+ * @param resultados Vetor onde fica o conjunto de cada regra
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int aplicarRegras(Vertice* lista, const TipoRegra* regras, int numRegras,
+                  const LimitesMapa* limites, ConjuntoEfeitos** resultados);
+
+/**
+ * @brief Aplica uma só regra
+ * @param lista Lista de antenas
+ * @param regra Regra a aplicar
+ * @param limites Limites do mapa (NULL para usar os limites das antenas)
+ * @return Conjunto com as posições afetadas, ou NULL em caso de erro
+ */
+ConjuntoEfeitos* aplicarRegra(Vertice* lista, TipoRegra regra, const LimitesMapa* limites);
+
+#endif
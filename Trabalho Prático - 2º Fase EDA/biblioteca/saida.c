@@ -0,0 +1,270 @@
+/**
+ * @file saida.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação da formatação dos resultados em memória
+ * @version 0.1
+ * @date 2025-06-08
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "saida.h"
+
+#pragma region Texto
+/**
+ * @brief Acrescenta n bytes ao texto, duplicando a memória reservada quando for preciso.
+ *
+ * O texto fica sempre terminado em '\0' (que não conta para o tamanho). Depois de um
+ * erro de memória as escritas seguintes são ignoradas e o campo "erro" fica a 1.
+ *
+ * @param t Texto.
+ * @param s Bytes a acrescentar.
+ * @param n Número de bytes.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+int acrescentarTexto(TextoSaida* t, const char* s, size_t n) {
+    if (!t || t->erro) return -1;
+    if (t->tamanho + n + 1 > t->capacidade) {
+        size_t capacidade = t->capacidade ? t->capacidade : 4096;
+        while (t->tamanho + n + 1 > capacidade) {
+            capacidade *= 2;
+        }
+        char* dados = (char*)realloc(t->dados, capacidade);
+        if (!dados) {
+            t->erro = 1;
+            return -1;
+        }
+        t->dados = dados;
+        t->capacidade = capacidade;
+    }
+    memcpy(t->dados + t->tamanho, s, n);
+    t->tamanho += n;
+    t->dados[t->tamanho] = '\0';
+    return 0;
+}
+
+/**
+ * @brief Acrescenta uma cadeia de caracteres ao texto.
+ *
+ * @param t Texto.
+ * @param s Cadeia terminada em '\0'.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+int acrescentarCadeia(TextoSaida* t, const char* s) {
+    return acrescentarTexto(t, s, strlen(s));
+}
+
+/**
+ * @brief Acrescenta um inteiro em decimal sem passar por printf.
+ *
+ * @param t Texto.
+ * @param valor Inteiro a escrever.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+int acrescentarInteiro(TextoSaida* t, int valor) {
+    char digitos[12];
+    int p = sizeof(digitos);
+    unsigned int u = valor < 0 ? 0u - (unsigned int)valor : (unsigned int)valor;
+    do {
+        digitos[--p] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u);
+    if (valor < 0) digitos[--p] = '-';
+    return acrescentarTexto(t, digitos + p, sizeof(digitos) - p);
+}
+
+/**
+ * @brief Acrescenta "(x, y)" ao texto.
+ */
+static int acrescentarPosicao(TextoSaida* t, int x, int y) {
+    acrescentarTexto(t, "(", 1);
+    acrescentarInteiro(t, x);
+    acrescentarTexto(t, ", ", 2);
+    acrescentarInteiro(t, y);
+    return acrescentarTexto(t, ")", 1);
+}
+
+/**
+ * @brief Escreve o texto num ficheiro com um só fwrite e esvazia-o para ser reutilizado.
+ *
+ * @param t Texto.
+ * @param ficheiro Ficheiro de destino (ex: stdout).
+ * @return 0 em caso de sucesso, -1 em caso de erro (de memória durante a formatação ou de escrita).
+ */
+int escreverTexto(TextoSaida* t, FILE* ficheiro) {
+    if (!t || !ficheiro) return -1;
+    int erro = t->erro;
+    if (t->tamanho > 0 && fwrite(t->dados, 1, t->tamanho, ficheiro) != t->tamanho) erro = 1;
+    limparTexto(t);
+    return erro ? -1 : 0;
+}
+
+/**
+ * @brief Esvazia o texto mantendo a memória reservada.
+ *
+ * @param t Texto.
+ * @return 0 em caso de sucesso.
+ */
+int limparTexto(TextoSaida* t) {
+    if (!t) return 0;
+    t->tamanho = 0;
+    t->erro = 0;
+    if (t->dados) t->dados[0] = '\0';
+    return 0;
+}
+
+/**
+ * @brief Liberta a memória do texto.
+ *
+ * @param t Texto.
+ * @return 0 em caso de sucesso.
+ */
+int libertarTexto(TextoSaida* t) {
+    if (!t) return 0;
+    free(t->dados);
+    t->dados = NULL;
+    t->tamanho = t->capacidade = 0;
+    t->erro = 0;
+    return 0;
+}
+#pragma endregion
+#pragma region Formatadores
+/**
+ * @brief Formata uma antena como "(x, y) freq f" seguida de fim de linha.
+ *
+ * @param t Texto.
+ * @param v Antena.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+int formatarVertice(TextoSaida* t, Vertice* v) {
+    if (!v) return 0;
+    char frequencia[8] = " freq X\n";
+    frequencia[6] = v->frequencia;
+    acrescentarPosicao(t, v->x, v->y);
+    return acrescentarTexto(t, frequencia, sizeof(frequencia));
+}
+
+/**
+ * @brief Formata as antenas visitadas por uma pesquisa, uma por linha.
+ *
+ * @param t Texto.
+ * @param vertices Antenas pela ordem de visita.
+ * @param n Número de antenas.
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória.
+ */
+int formatarVisita(TextoSaida* t, Vertice** vertices, int n) {
+    int erro = 0;
+    for (int i = 0; i < n; i++) {
+        erro |= formatarVertice(t, vertices[i]);
+    }
+    return erro ? -1 : 0;
+}
+
+/**
+ * @brief Formata a tabela de antenas (frequência e coordenadas) usada por listarAntenas.
+ *
+ * @param t Texto.
+ * @param lista Apontador para o início da lista de antenas.
+ * @return Número de antenas formatadas.
+ */
+int formatarAntenas(TextoSaida* t, Vertice* lista) {
+    int contador = 0;
+    acrescentarCadeia(t, "\nLista de Antenas:\n");
+    acrescentarCadeia(t, "Frequência | Coordenadas (x, y)\n");
+    acrescentarCadeia(t, "-------------------------------\n");
+    for (Vertice* v = lista; v; v = v->prox, contador++) {
+        char linha[16] = "    X      |    ";
+        linha[4] = v->frequencia;
+        acrescentarTexto(t, linha, sizeof(linha));
+        acrescentarPosicao(t, v->x, v->y);
+        acrescentarTexto(t, "\n", 1);
+    }
+    return contador;
+}
+
+/**
+ * @brief Formata um caminho como "(x, y) -> (x, y) -> ..." seguido de fim de linha.
+ *
+ * @param t Texto.
+ * @param caminho Vértices do caminho.
+ * @param tamanho Número de vértices.
+ * @return 0 em caso de sucesso, -1 se o caminho for inválido ou faltar memória.
+ */
+int formatarCaminho(TextoSaida* t, Vertice** caminho, int tamanho) {
+    if (!caminho || tamanho <= 0) return -1;
+    for (int i = 0; i < tamanho; i++) {
+        if (!caminho[i]) return -1;
+        acrescentarPosicao(t, caminho[i]->x, caminho[i]->y);
+        if (i < tamanho - 1) acrescentarTexto(t, " -> ", 4);
+    }
+    return acrescentarTexto(t, "\n", 1);
+}
+
+/**
+ * @brief Formata um caminho do grafo CSR como "(x, y) -> (x, y) -> ..." seguido de fim de linha.
+ *
+ * @param t Texto.
+ * @param g Grafo CSR.
+ * @param caminho Números dos vértices do caminho.
+ * @param tamanho Número de vértices.
+ * @return 0 em caso de sucesso, -1 se o caminho for inválido ou faltar memória.
+ */
+int formatarCaminhoCSR(TextoSaida* t, GrafoCSR* g, const int* caminho, int tamanho) {
+    if (!g || !caminho || tamanho <= 0) return -1;
+    for (int i = 0; i < tamanho; i++) {
+        int v = caminho[i];
+        if (v < 0 || v >= g->numVertices) return -1;
+        acrescentarPosicao(t, g->x[v], g->y[v]);
+        if (i < tamanho - 1) acrescentarTexto(t, " -> ", 4);
+    }
+    return acrescentarTexto(t, "\n", 1);
+}
+
+/**
+ * @brief Formata as posições de um conjunto de efeitos ("Vertical: (x, y)", "Horizontal: (x, y)" ou "Diagonal: (x, y)").
+ *
+ * Se o conjunto estiver vazio escreve "Nenhum efeito nefasto encontrado.".
+ *
+ * @param t Texto.
+ * @param efeitos Conjunto de efeitos.
+ * @return Número de posições formatadas.
+ */
+int formatarEfeitos(TextoSaida* t, ConjuntoEfeitos* efeitos) {
+    if (!efeitos) return 0;
+    for (int i = 0; i < efeitos->total; i++) {
+        if (efeitos->direcao[i] == DIRECAO_MESMO_X) {
+            acrescentarCadeia(t, "Vertical: ");
+        } else if (efeitos->direcao[i] == DIRECAO_DIAGONAL) {
+            acrescentarCadeia(t, "Diagonal: ");
+        } else {
+            acrescentarCadeia(t, "Horizontal: ");
+        }
+        acrescentarPosicao(t, efeitos->celulas[i].x, efeitos->celulas[i].y);
+        acrescentarTexto(t, "\n", 1);
+    }
+    if (efeitos->total == 0) {
+        acrescentarCadeia(t, "Nenhum efeito nefasto encontrado.\n");
+    }
+    return efeitos->total;
+}
+
+/**
+ * @brief Formata as posições de interseção ("Interseção em (x, y)").
+ *
+ * @param t Texto.
+ * @param r Resultado de calcularIntersecoes.
+ * @return Número de posições formatadas.
+ */
+int formatarIntersecoes(TextoSaida* t, ResultadoIntersecoes* r) {
+    if (!r) return 0;
+    for (int i = 0; i < r->num; i++) {
+        acrescentarCadeia(t, "Interseção em ");
+        acrescentarPosicao(t, r->posicoes[i].x, r->posicoes[i].y);
+        acrescentarTexto(t, "\n", 1);
+    }
+    return r->num;
+}
+#pragma endregion
@@ -0,0 +1,141 @@
+/**
+ * @file saida.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Formatação dos resultados num texto em memória, escrito de uma só vez
+ * @version 0.1
+ * @date 2025-06-08
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SAIDA_H
+#define SAIDA_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include "grafo.h"
+#include "efeitos.h"
+#include "intersecoes.h"
+#include "csr.h"
+
+/**
+ * @brief Texto que cresce à medida que os resultados são formatados.
+ *
+ * Pode ser declarado com { 0 } e reutilizado com limparTexto.
+ */
+typedef struct textoSaida {
+    char* dados;
+    size_t tamanho;
+    size_t capacidade;
+    int erro;                    // 1 se faltou memória em alguma escrita
+} TextoSaida;
+
+/**
+ * @brief Acrescenta bytes ao texto
+ * @param t Texto
+ * @param s Bytes a acrescentar
+ * @param n Número de bytes
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+int acrescentarTexto(TextoSaida* t, const char* s, size_t n);
+
+/**
+ * @brief Acrescenta uma cadeia de caracteres terminada em '\0'
+ * @param t Texto
+ * @param s Cadeia
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+int acrescentarCadeia(TextoSaida* t, const char* s);
+
+/**
+ * @brief Acrescenta um inteiro em decimal
+ * @param t Texto
+ * @param valor Inteiro
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+int acrescentarInteiro(TextoSaida* t, int valor);
+
+/**
+ * @brief Formata uma antena como "(x, y) freq f" (formato de dfs)
+ * @param t Texto
+ * @param v Antena
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+int formatarVertice(TextoSaida* t, Vertice* v);
+
+/**
+ * @brief Formata uma sequência de antenas, uma por linha (ordem de visita de uma pesquisa)
+ * @param t Texto
+ * @param vertices Antenas
+ * @param n Número de antenas
+ * @return 0 em caso de sucesso, -1 em caso de erro de memória
+ */
+int formatarVisita(TextoSaida* t, Vertice** vertices, int n);
+
+/**
+ * @brief Formata a tabela de antenas de listarAntenas
+ * @param t Texto
+ * @param lista Lista de antenas
+ * @return Número de antenas formatadas
+ */
+int formatarAntenas(TextoSaida* t, Vertice* lista);
+
+/**
+ * @brief Formata um caminho como "(x, y) -> (x, y) -> ..."
+ * @param t Texto
+ * @param caminho Vértices do caminho
+ * @param tamanho Número de vértices
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int formatarCaminho(TextoSaida* t, Vertice** caminho, int tamanho);
+
+/**
+ * @brief Formata um caminho do grafo CSR como "(x, y) -> (x, y) -> ..."
+ * @param t Texto
+ * @param g Grafo CSR
+ * @param caminho Números dos vértices do caminho
+ * @param tamanho Número de vértices
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int formatarCaminhoCSR(TextoSaida* t, GrafoCSR* g, const int* caminho, int tamanho);
+
+/**
+ * @brief Formata as posições de um conjunto de efeitos nefastos
+ * @param t Texto
+ * @param efeitos Conjunto de efeitos
+ * @return Número de posições formatadas
+ */
+int formatarEfeitos(TextoSaida* t, ConjuntoEfeitos* efeitos);
+
+/**
+ * @brief Formata as posições de interseção
+ * @param t Texto
+ * @param r Resultado de calcularIntersecoes
+ * @return Número de posições formatadas
+ */
+int formatarIntersecoes(TextoSaida* t, ResultadoIntersecoes* r);
+
+/**
+ * @brief Escreve o texto num ficheiro com uma só escrita e esvazia-o
+ * @param t Texto
+ * @param ficheiro Ficheiro de destino (ex: stdout)
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int escreverTexto(TextoSaida* t, FILE* ficheiro);
+
+/**
+ * @brief Esvazia o texto mantendo a memória reservada
+ * @param t Texto
+ * @return 0 em caso de sucesso
+ */
+int limparTexto(TextoSaida* t);
+
+/**
+ * @brief Liberta a memória do texto
+ * @param t Texto
+ * @return 0 em caso de sucesso
+ */
+int libertarTexto(TextoSaida* t);
+
+#endif
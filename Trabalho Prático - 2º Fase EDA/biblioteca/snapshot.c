@@ -0,0 +1,292 @@
+/**
+ * @file snapshot.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Implementação do formato binário versionado do grafo de antenas
+ * @version 0.1
+ * @date 2025-05-29
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "snapshot.h"
+#include "memoria.h"
+
+#pragma region Bytes
+/**
+ * @brief Escreve um inteiro de 32 bits em little-endian, independentemente da máquina.
+ */
+static unsigned char* escreverU32(unsigned char* p, uint32_t valor) {
+    p[0] = (unsigned char)(valor);
+    p[1] = (unsigned char)(valor >> 8);
+    p[2] = (unsigned char)(valor >> 16);
+    p[3] = (unsigned char)(valor >> 24);
+    return p + 4;
+}
+
+/**
+ * @brief Lê um inteiro de 32 bits escrito em little-endian.
+ */
+static uint32_t lerU32(const unsigned char* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief Calcula o valor de verificação FNV-1a de 32 bits de um conjunto de bytes.
+ *
+ * @param dados Bytes a verificar.
+ * @param tamanho Número de bytes.
+ * @return Valor de verificação.
+ */
+uint32_t verificacaoSnapshot(const unsigned char* dados, size_t tamanho) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < tamanho; i++) {
+        h ^= dados[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+#pragma endregion
+#pragma region Guardar Snapshot
+/**
+ * @brief Guarda a lista de antenas e as suas adjacências num ficheiro binário.
+ *
+ * Os vértices são numerados pela ordem da lista (numerarVertices) e cada adjacência
+ * é guardada como o número do vértice de destino, por isso o ficheiro não depende
+ * de endereços de memória nem do tamanho das estruturas. Todo o conteúdo é preparado
+ * num único buffer e escrito com um só fwrite. As adjacências para vértices que não
+ * pertencem à lista são ignoradas.
+ *
+ * @param lista Apontador para o início da lista de antenas.
+ * @param nomeFicheiro Nome do ficheiro a escrever (ex: "antenas.bin").
+ * @return 0 em caso de sucesso, -1 em caso de erro.
+ */
+int guardarGrafoBinario(Vertice* lista, const char* nomeFicheiro) {
+    if (!nomeFicheiro) return -1;
+    int numVertices = numerarVertices(lista);
+    Vertice** vertices = NULL;
+    if (numVertices > 0) {
+        vertices = (Vertice**)malloc((size_t)numVertices * sizeof(Vertice*));
+        if (!vertices) {
+            printf("Erro ao alocar memória para o snapshot!\n");
+            return -1;
+        }
+    }
+    // 1ª passagem: guardar os vértices por número e contar as arestas válidas
+    size_t numArestas = 0;
+    int i = 0;
+    for (Vertice* v = lista; v; v = v->prox) {
+        vertices[i++] = v;
+    }
+    for (Vertice* v = lista; v; v = v->prox) {
+        for (AdjD* adj = v->adjacencias; adj; adj = adj->next) {
+            Vertice* d = adj->destino;
+            if (d && d->id >= 0 && d->id < numVertices && vertices[d->id] == d) numArestas++;
+        }
+    }
+    size_t tamanho = SNAPSHOT_CABECALHO
+                   + (size_t)numVertices * SNAPSHOT_REGISTO_VERTICE
+                   + ((size_t)numVertices + 1) * 4
+                   + numArestas * 4
+                   + 4;
+    unsigned char* buffer = (unsigned char*)malloc(tamanho);
+    if (!buffer) {
+        printf("Erro ao alocar memória para o snapshot!\n");
+        free(vertices);
+        return -1;
+    }
+    // Cabeçalho
+    unsigned char* p = buffer;
+    memcpy(p, SNAPSHOT_MAGICO, 4);
+    p += 4;
+    p = escreverU32(p, SNAPSHOT_VERSAO);
+    p = escreverU32(p, (uint32_t)numVertices);
+    p = escreverU32(p, (uint32_t)numArestas);
+    // Vértices
+    for (i = 0; i < numVertices; i++) {
+        p = escreverU32(p, (uint32_t)vertices[i]->x);
+        p = escreverU32(p, (uint32_t)vertices[i]->y);
+        *p++ = (unsigned char)vertices[i]->frequencia;
+    }
+    // Arestas em formato CSR: primeiro as posições de início, depois os destinos
+    unsigned char* inicio = p;
+    unsigned char* vizinhos = p + ((size_t)numVertices + 1) * 4;
+    uint32_t total = 0;
+    for (i = 0; i < numVertices; i++) {
+        escreverU32(inicio + (size_t)i * 4, total);
+        for (AdjD* adj = vertices[i]->adjacencias; adj; adj = adj->next) {
+            Vertice* d = adj->destino;
+            if (d && d->id >= 0 && d->id < numVertices && vertices[d->id] == d) {
+                escreverU32(vizinhos + (size_t)total * 4, (uint32_t)d->id);
+                total++;
+            }
+        }
+    }
+    escreverU32(inicio + (size_t)numVertices * 4, total);
+    p = vizinhos + (size_t)total * 4;
+    escreverU32(p, verificacaoSnapshot(buffer, tamanho - 4));
+    free(vertices);
+
+    FILE* file = fopen(nomeFicheiro, "wb");
+    if (!file) {
+        free(buffer);
+        return -1;
+    }
+    size_t escritos = fwrite(buffer, 1, tamanho, file);
+    free(buffer);
+    if (fclose(file) != 0 || escritos != tamanho) {
+        return -1;
+    }
+    return 0;
+}
+#pragma endregion
+#pragma region Carregar Snapshot
+/**
+ * @brief Carrega a lista de antenas e as suas adjacências de um ficheiro binário.
+ *
+ * O ficheiro é lido de uma só vez e validado (identificador, versão, tamanho
+ * esperado, valor de verificação e limites dos índices) antes de ser criado
+ * qualquer vértice. Depois os vértices são ligados pela ordem guardada (que já
+ * está ordenada) e as adjacências são recriadas pela mesma ordem, sem ser
+ * preciso voltar a ler o texto nem a calcular as ligações.
+ *
+ * @param nomeFicheiro Nome do ficheiro a ler (ex: "antenas.bin").
+ * @param arena Arena onde são criados os vértices e adjacências (NULL para usar malloc).
+ * @return Apontador para a lista carregada, ou NULL se o ficheiro não existir, for inválido ou estiver vazio.
+ */
+Vertice* carregarAntenasDeFicheiroBinario(const char* nomeFicheiro, ArenaGrafo* arena) {
+    if (!nomeFicheiro) return NULL;
+    FILE* file = fopen(nomeFicheiro, "rb");
+    if (!file) {
+        printf("Erro ao abrir o ficheiro!\n");
+        return NULL;
+    }
+    unsigned char cabecalho[SNAPSHOT_CABECALHO];
+    if (fread(cabecalho, 1, SNAPSHOT_CABECALHO, file) != SNAPSHOT_CABECALHO ||
+        memcmp(cabecalho, SNAPSHOT_MAGICO, 4) != 0) {
+        printf("Ficheiro binário inválido!\n");
+        fclose(file);
+        return NULL;
+    }
+    if (lerU32(cabecalho + 4) != SNAPSHOT_VERSAO) {
+        printf("Versão do ficheiro binário não suportada!\n");
+        fclose(file);
+        return NULL;
+    }
+    uint32_t numVertices = lerU32(cabecalho + 8);
+    uint32_t numArestas = lerU32(cabecalho + 12);
+    if (numVertices > 0x7FFFFFFEu || numArestas > 0x7FFFFFFEu) {
+        printf("Ficheiro binário inválido!\n");
+        fclose(file);
+        return NULL;
+    }
+    size_t tamanho = SNAPSHOT_CABECALHO
+                   + (size_t)numVertices * SNAPSHOT_REGISTO_VERTICE
+                   + ((size_t)numVertices + 1) * 4
+                   + (size_t)numArestas * 4
+                   + 4;
+    unsigned char* buffer = (unsigned char*)malloc(tamanho);
+    if (!buffer) {
+        printf("Erro ao alocar memória para o snapshot!\n");
+        fclose(file);
+        return NULL;
+    }
+    memcpy(buffer, cabecalho, SNAPSHOT_CABECALHO);
+    size_t lidos = fread(buffer + SNAPSHOT_CABECALHO, 1, tamanho - SNAPSHOT_CABECALHO, file);
+    int sobra = fgetc(file);
+    fclose(file);
+    if (lidos != tamanho - SNAPSHOT_CABECALHO || sobra != EOF ||
+        verificacaoSnapshot(buffer, tamanho - 4) != lerU32(buffer + tamanho - 4)) {
+        printf("Ficheiro binário inválido!\n");
+        free(buffer);
+        return NULL;
+    }
+    const unsigned char* registos = buffer + SNAPSHOT_CABECALHO;
+    const unsigned char* inicio = registos + (size_t)numVertices * SNAPSHOT_REGISTO_VERTICE;
+    const unsigned char* vizinhos = inicio + ((size_t)numVertices + 1) * 4;
+    // Validar as arestas antes de criar qualquer nó
+    uint32_t anterior = 0;
+    for (uint32_t i = 0; i <= numVertices; i++) {
+        uint32_t atual = lerU32(inicio + (size_t)i * 4);
+        if (atual < anterior || atual > numArestas || (i == 0 && atual != 0)) {
+            printf("Ficheiro binário inválido!\n");
+            free(buffer);
+            return NULL;
+        }
+        anterior = atual;
+    }
+    if (anterior != numArestas) {
+        printf("Ficheiro binário inválido!\n");
+        free(buffer);
+        return NULL;
+    }
+    for (uint32_t e = 0; e < numArestas; e++) {
+        if (lerU32(vizinhos + (size_t)e * 4) >= numVertices) {
+            printf("Ficheiro binário inválido!\n");
+            free(buffer);
+            return NULL;
+        }
+    }
+    if (numVertices == 0) {
+        free(buffer);
+        return NULL;
+    }
+    Vertice** vertices = (Vertice**)malloc((size_t)numVertices * sizeof(Vertice*));
+    if (!vertices) {
+        printf("Erro ao alocar memória para o snapshot!\n");
+        free(buffer);
+        return NULL;
+    }
+    // Criar e ligar os vértices pela ordem guardada
+    Vertice* lista = NULL;
+    Vertice* cauda = NULL;
+    for (uint32_t i = 0; i < numVertices; i++) {
+        const unsigned char* r = registos + (size_t)i * SNAPSHOT_REGISTO_VERTICE;
+        Vertice* nova = criarAntenaArena(arena, (char)r[8], (int)lerU32(r), (int)lerU32(r + 4));
+        if (!nova) {
+            printf("Erro ao alocar memória para o snapshot!\n");
+            free(vertices);
+            free(buffer);
+            if (!arena) libertarMemoria(lista);
+            return NULL;
+        }
+        nova->id = (int)i;
+        nova->ant = cauda;
+        if (cauda) {
+            cauda->prox = nova;
+        } else {
+            lista = nova;
+        }
+        cauda = nova;
+        vertices[i] = nova;
+    }
+    // Recriar as adjacências pela ordem original
+    for (uint32_t i = 0; i < numVertices; i++) {
+        uint32_t a = lerU32(inicio + (size_t)i * 4);
+        uint32_t b = lerU32(inicio + (size_t)(i + 1) * 4);
+        AdjD* ultima = NULL;
+        for (uint32_t e = a; e < b; e++) {
+            AdjD* nova = criarAdjacenciaArena(arena, vertices[i], vertices[lerU32(vizinhos + (size_t)e * 4)]);
+            if (!nova) {
+                printf("Erro ao alocar memória para a adjacência!\n");
+                free(vertices);
+                free(buffer);
+                if (!arena) libertarMemoria(lista);
+                return NULL;
+            }
+            if (ultima) {
+                ultima->next = nova;
+            } else {
+                vertices[i]->adjacencias = nova;
+            }
+            ultima = nova;
+        }
+    }
+    free(vertices);
+    free(buffer);
+    return lista;
+}
+#pragma endregion
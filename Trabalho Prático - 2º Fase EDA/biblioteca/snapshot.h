@@ -0,0 +1,56 @@
+/**
+ * @file snapshot.h
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Formato binário versionado para guardar e recarregar o grafo de antenas
+ * @version 0.1
+ * @date 2025-05-29
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdint.h>
+#include "grafo.h"
+
+/**
+ * Organização do ficheiro (todos os inteiros em little-endian, sem espaços entre campos):
+ *
+ *   Cabeçalho   "ANTG", versão, número de vértices, número de arestas (4 x 4 bytes)
+ *   Vértices    x (4), y (4), frequência (1) para cada vértice, pela ordem da lista
+ *   Início      posição do primeiro vizinho de cada vértice (numVertices + 1 inteiros)
+ *   Vizinhos    número do vértice de destino de cada aresta (numArestas inteiros)
+ *   Verificação FNV-1a de 32 bits de todos os bytes anteriores
+ */
+#define SNAPSHOT_MAGICO "ANTG"
+#define SNAPSHOT_VERSAO 1
+#define SNAPSHOT_CABECALHO 16
+#define SNAPSHOT_REGISTO_VERTICE 9
+
+/**
+ * @brief Guarda a lista de antenas e as suas adjacências no formato binário
+ * @param lista Lista de antenas
+ * @param nomeFicheiro Nome do ficheiro a escrever
+ * @return 0 em caso de sucesso, -1 em caso de erro
+ */
+int guardarGrafoBinario(Vertice* lista, const char* nomeFicheiro);
+
+/**
+ * @brief Carrega a lista de antenas e as suas adjacências de um ficheiro binário
+ * @param nomeFicheiro Nome do ficheiro a ler
+ * @param arena Arena onde são criados os nós (NULL para usar malloc)
+ * @return Apontador para a lista carregada, ou NULL se o ficheiro for inválido
+ */
+Vertice* carregarAntenasDeFicheiroBinario(const char* nomeFicheiro, ArenaGrafo* arena);
+
+/**
+ * @brief Calcula o valor de verificação FNV-1a de 32 bits
+ * @param dados Bytes a verificar
+ * @param tamanho Número de bytes
+ * @return Valor de verificação
+ */
+uint32_t verificacaoSnapshot(const unsigned char* dados, size_t tamanho);
+
+#endif
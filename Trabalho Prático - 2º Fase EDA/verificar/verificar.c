@@ -0,0 +1,507 @@
+/**
+ * @file verificar.c
+ * @author Ricardo (ricardopereira15jr@gmail.com)
+ * @brief Verificação das implementações alternativas contra as implementações de referência
+ * @version 0.1
+ * @date 2025-06-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Utilização: verificar.exe [mapas] [semente]
+ *
+ * Gera mapas aleatórios pequenos (por omissão 40) e confirma que:
+ * - calcularEfeitosGrelha, aplicarKernels, calcularEfeitosParalelo, o rastreador de efeitos
+ *   e processarPorFaixas dão as mesmas posições (e alinhamentos) que calcularEfeitos;
+ * - dfsCSR, bfsCSR e dfs visitam os mesmos vértices, pela mesma ordem, que dfsOrdem e bfsOrdem;
+ * - a contagem por fórmula fechada de procurarCaminhos é igual à enumeração, e
+ *   procurarCaminhosCSR encontra os mesmos caminhos pela mesma ordem;
+ * - guardar e voltar a ler o snapshot binário, o formato RLE, os registos "f x y" (com
+ *   remoções, como no diário) e o grafo mapeado devolve a mesma lista.
+ * Termina com código 1 se alguma verificação falhar.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "../biblioteca/grafo.h"
+#include "../biblioteca/indice.h"
+#include "../biblioteca/efeitos.h"
+#include "../biblioteca/csr.h"
+#include "../biblioteca/leitura.h"
+#include "../biblioteca/memoria.h"
+#include "../biblioteca/snapshot.h"
+#include "../biblioteca/mapeado.h"
+#include "../biblioteca/caminhos.h"
+#include "../biblioteca/grelha.h"
+#include "../biblioteca/regras.h"
+#include "../biblioteca/faixas.h"
+#include "../biblioteca/formatos.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define NULO "NUL"
+#define dup _dup
+#define dup2 _dup2
+#define fileno _fileno
+#define close _close
+#else
+#include <unistd.h>
+#define NULO "/dev/null"
+#endif
+
+#define MAPA_VERIFICAR "verificar_mapa.txt"
+#define SNAPSHOT_VERIFICAR "verificar_mapa.bin"
+#define MAPEADO_VERIFICAR "verificar_mapa.map"
+#define RLE_VERIFICAR "verificar_mapa_rle.txt"
+#define REGISTOS_VERIFICAR "verificar_mapa_registos.txt"
+
+#pragma region Saída
+static int saidaGuardada = -1;
+
+/**
+ * @brief Envia o stdout para o dispositivo nulo (as funções verificadas imprimem resultados).
+ */
+static void silenciarSaida(void) {
+    fflush(stdout);
+    saidaGuardada = dup(fileno(stdout));
+    FILE* nulo = fopen(NULO, "w");
+    if (nulo) {
+        dup2(fileno(nulo), fileno(stdout));
+        fclose(nulo);
+    }
+}
+
+/**
+ * @brief Repõe o stdout depois de silenciarSaida.
+ */
+static void reporSaida(void) {
+    fflush(stdout);
+    if (saidaGuardada >= 0) {
+        dup2(saidaGuardada, fileno(stdout));
+        close(saidaGuardada);
+        saidaGuardada = -1;
+    }
+}
+
+static int falhas = 0;
+
+/**
+ * @brief Regista o resultado de uma verificação; só as falhas são mostradas.
+ *
+ * @param nome Nome da verificação.
+ * @param mapa Número do mapa.
+ * @param ok 1 se a verificação passou.
+ * @return ok
+ */
+static int confirmar(const char* nome, int mapa, int ok) {
+    if (!ok) {
+        printf("FALHOU  %-40s mapa %d\n", nome, mapa);
+        falhas++;
+    }
+    return ok;
+}
+#pragma endregion
+#pragma region Gerar Mapa
+/**
+ * @brief Gerador pseudoaleatório xorshift64* (o mesmo mapa para a mesma semente).
+ */
+static uint64_t aleatorio(uint64_t* estado) {
+    uint64_t x = *estado;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *estado = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief Gera um mapa aleatório pequeno no formato de "antenas.txt".
+ *
+ * Os mapas são pequenos e densos para haver muitas antenas alinhadas e
+ * vários caminhos entre elas.
+ *
+ * @param nomeFicheiro Ficheiro a escrever.
+ * @param estado Estado do gerador.
+ * @return 0 em caso de sucesso, -1 em caso de erro.
+ */
+static int gerarMapa(const char* nomeFicheiro, uint64_t* estado) {
+    FILE* file = fopen(nomeFicheiro, "w");
+    if (!file) {
+        printf("Erro ao criar o ficheiro %s!\n", nomeFicheiro);
+        return -1;
+    }
+    int linhas = 4 + (int)(aleatorio(estado) % 12);
+    int colunas = 4 + (int)(aleatorio(estado) % 12);
+    int frequencias = 1 + (int)(aleatorio(estado) % 3);
+    int percentagem = 10 + (int)(aleatorio(estado) % 20);
+    for (int i = 0; i < linhas; i++) {
+        for (int j = 0; j < colunas; j++) {
+            int antena = (int)(aleatorio(estado) % 100) < percentagem;
+            fputc(antena ? "ABC"[aleatorio(estado) % (uint64_t)frequencias] : '.', file);
+        }
+        fputc('\n', file);
+    }
+    fclose(file);
+    return 0;
+}
+#pragma endregion
+#pragma region Comparar
+/**
+ * @brief Posição com efeito e o seu alinhamento, para comparar conjuntos pela mesma ordem.
+ */
+typedef struct efeitoOrdenado {
+    int x, y;
+    char direcao;
+} EfeitoOrdenado;
+
+static int compararEfeitos(const void* a, const void* b) {
+    const EfeitoOrdenado* p = (const EfeitoOrdenado*)a;
+    const EfeitoOrdenado* q = (const EfeitoOrdenado*)b;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    return (p->y > q->y) - (p->y < q->y);
+}
+
+/**
+ * @brief Copia as posições de um conjunto de efeitos ordenadas por (x, y).
+ */
+static EfeitoOrdenado* ordenarEfeitos(const Coordenada* celulas, const char* direcao, int total) {
+    EfeitoOrdenado* v = (EfeitoOrdenado*)malloc((size_t)(total + 1) * sizeof(EfeitoOrdenado));
+    if (!v) return NULL;
+    for (int i = 0; i < total; i++) {
+        v[i].x = celulas[i].x;
+        v[i].y = celulas[i].y;
+        v[i].direcao = direcao[i];
+    }
+    qsort(v, (size_t)total, sizeof(EfeitoOrdenado), compararEfeitos);
+    return v;
+}
+
+/**
+ * @brief Compara dois conjuntos de efeitos (posições e alinhamento), sem contar com a ordem.
+ *
+ * @return 1 se forem iguais, 0 caso contrário.
+ */
+static int mesmosEfeitos(const ConjuntoEfeitos* a, const ConjuntoEfeitos* b) {
+    if (!a || !b) return 0;
+    if (a->total != b->total) return 0;
+    EfeitoOrdenado* p = ordenarEfeitos(a->celulas, a->direcao, a->total);
+    EfeitoOrdenado* q = ordenarEfeitos(b->celulas, b->direcao, b->total);
+    int iguais = p && q;
+    for (int i = 0; iguais && i < a->total; i++) {
+        iguais = p[i].x == q[i].x && p[i].y == q[i].y && p[i].direcao == q[i].direcao;
+    }
+    free(p);
+    free(q);
+    return iguais;
+}
+
+/**
+ * @brief Compara duas listas de antenas e, se pedido, as adjacências de cada vértice.
+ *
+ * @return 1 se forem iguais, 0 caso contrário.
+ */
+static int mesmasListas(Vertice* a, Vertice* b, int comAdjacencias) {
+    for (; a && b; a = a->prox, b = b->prox) {
+        if (a->frequencia != b->frequencia || a->x != b->x || a->y != b->y) return 0;
+        if (!comAdjacencias) continue;
+        AdjD* p = a->adjacencias;
+        AdjD* q = b->adjacencias;
+        for (; p && q; p = p->next, q = q->next) {
+            if (p->destino->x != q->destino->x || p->destino->y != q->destino->y ||
+                p->destino->frequencia != q->destino->frequencia) return 0;
+        }
+        if (p || q) return 0;
+    }
+    return !a && !b;
+}
+#pragma endregion
+#pragma region Efeitos
+/**
+ * @brief Junta os efeitos de cada faixa num só conjunto.
+ */
+static int juntarFaixa(const FaixaMapa* faixa, void* contexto) {
+    ConjuntoEfeitos* c = (ConjuntoEfeitos*)contexto;
+    for (int i = 0; i < faixa->numEfeitos; i++) {
+        if (adicionarEfeito(c, faixa->efeitos[i].x, faixa->efeitos[i].y, faixa->direcao[i]) < 0) return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Compara os motores de efeitos nefastos com calcularEfeitos.
+ */
+static void verificarEfeitos(Vertice* lista, int mapa) {
+    ConjuntoEfeitos* referencia = calcularEfeitos(lista, EFEITO_DISTANCIA_2);
+    ConjuntoEfeitos* referenciaPar = calcularEfeitos(lista, EFEITO_DISTANCIA_PAR);
+
+    GrelhaAntenas* grelha = criarGrelha(lista);
+    ConjuntoEfeitos* c = grelha ? calcularEfeitosGrelha(grelha) : NULL;
+    confirmar("calcularEfeitosGrelha", mapa, mesmosEfeitos(referencia, c));
+    libertarConjuntoEfeitos(c);
+    libertarGrelha(grelha);
+
+    KernelRegra kernels[2] = { kernelDaRegra(REGRA_DISTANCIA_2), kernelDaRegra(REGRA_DISTANCIA_PAR) };
+    ConjuntoEfeitos* resultados[2] = { NULL, NULL };
+    int ok = aplicarKernels(lista, kernels, 2, NULL, resultados) == 0;
+    confirmar("aplicarKernels distância 2", mapa, ok && mesmosEfeitos(referencia, resultados[0]));
+    confirmar("aplicarKernels distância par", mapa, ok && mesmosEfeitos(referenciaPar, resultados[1]));
+    libertarConjuntoEfeitos(resultados[0]);
+    libertarConjuntoEfeitos(resultados[1]);
+
+    c = calcularEfeitosParalelo(lista, EFEITO_DISTANCIA_2, 4);
+    confirmar("calcularEfeitosParalelo", mapa, mesmosEfeitos(referencia, c));
+    libertarConjuntoEfeitos(c);
+
+    // Rastreador atualizado a cada inserção indexada, por ordem inversa da lista
+    IndiceAntenas* indice = criarIndice(0);
+    RastreadorEfeitos* r = indice ? ativarRastreadorEfeitos(indice, NULL) : NULL;
+    Vertice* copia = NULL;
+    int res;
+    Vertice* ultimo = lista;
+    while (ultimo && ultimo->prox) ultimo = ultimo->prox;
+    for (Vertice* v = ultimo; r && v; v = v->ant) {
+        copia = InsereAntenaIndexada(criarAntena(v->frequencia, v->x, v->y), copia, indice, &res);
+    }
+    c = r ? exportarEfeitos(r) : NULL;
+    confirmar("rastreador de efeitos", mapa, mesmosEfeitos(referencia, c));
+    confirmar("InsereAntenaIndexada fora de ordem", mapa, r && mesmasListas(lista, copia, 0));
+    libertarConjuntoEfeitos(c);
+    libertarIndice(indice);
+    libertarMemoria(copia);
+
+    c = criarConjuntoEfeitos(0);
+    ok = c && processarPorFaixas(MAPA_VERIFICAR, 3, juntarFaixa, c) > 0;
+    confirmar("processarPorFaixas", mapa, ok && mesmosEfeitos(referencia, c));
+    libertarConjuntoEfeitos(c);
+
+    libertarConjuntoEfeitos(referencia);
+    libertarConjuntoEfeitos(referenciaPar);
+}
+#pragma endregion
+#pragma region Pesquisas
+/**
+ * @brief Compara as pesquisas em CSR com as pesquisas sobre a lista.
+ */
+static void verificarPesquisas(Vertice* lista, GrafoCSR* g, int mapa) {
+    int n = g->numVertices;
+    Vertice** ordemLista = (Vertice**)malloc((size_t)(n + 1) * sizeof(Vertice*));
+    int* ordemCSR = (int*)malloc((size_t)(n + 1) * sizeof(int));
+    int* distancia = (int*)malloc((size_t)(n + 1) * sizeof(int));
+    if (!ordemLista || !ordemCSR || !distancia) {
+        confirmar("memória para as pesquisas", mapa, 0);
+        free(ordemLista);
+        free(ordemCSR);
+        free(distancia);
+        return;
+    }
+    int dfsIgual = 1, bfsIgual = 1, recursivaIgual = 1;
+    int i = 0;
+    for (Vertice* v = lista; v; v = v->prox, i++) {
+        int a = dfsOrdem(v, ordemLista, n);
+        int b = dfsCSR(g, i, ordemCSR);
+        dfsIgual = dfsIgual && a == b;
+        for (int k = 0; dfsIgual && k < a; k++) dfsIgual = g->vertices[ordemCSR[k]] == ordemLista[k];
+
+        a = bfsOrdem(v, ordemLista, n);
+        b = bfsCSR(g, i, ordemCSR, distancia);
+        bfsIgual = bfsIgual && a == b;
+        for (int k = 0; bfsIgual && k < a; k++) bfsIgual = g->vertices[ordemCSR[k]] == ordemLista[k];
+
+        limparVisitados(lista);
+        silenciarSaida();
+        dfs(v);
+        reporSaida();
+        int visitados = 0;
+        for (Vertice* u = lista; u; u = u->prox) visitados += u->visitado != 0;
+        recursivaIgual = recursivaIgual && visitados == b;
+    }
+    confirmar("dfsCSR = dfsOrdem", mapa, dfsIgual);
+    confirmar("bfsCSR = bfsOrdem", mapa, bfsIgual);
+    confirmar("dfs = bfsCSR (vértices marcados)", mapa, recursivaIgual);
+    free(ordemLista);
+    free(ordemCSR);
+    free(distancia);
+}
+
+/**
+ * @brief Compara a contagem por fórmula fechada com a enumeração e os caminhos em CSR com os da lista.
+ *
+ * Só usa pares de antenas com poucas antenas da mesma frequência, para a enumeração ser rápida.
+ */
+static void verificarCaminhos(Vertice* lista, GrafoCSR* g, int mapa) {
+    int contagemIgual = 1, cliqueUsada = 1, csrIgual = 1, iterativoIgual = 1;
+    int pares = 0;
+    for (int o = 0; o < g->numVertices && pares < 12; o++) {
+        for (int d = 0; d < g->numVertices && pares < 12; d++) {
+            if (o == d || g->frequencia[o] != g->frequencia[d]) continue;
+            if (g->inicio[o + 1] - g->inicio[o] > 6) continue;
+            pares++;
+            Vertice* origem = g->vertices[o];
+            Vertice* destino = g->vertices[d];
+            ConsultaCaminhos contar = { 0, 0, 0 };
+            ConsultaCaminhos guardar = { 0, 0, 1 };
+            ResultadoCaminhos* fechada = procurarCaminhos(origem, destino, contar);
+            ResultadoCaminhos* enumerados = procurarCaminhos(origem, destino, guardar);
+            CaminhosCSR* csr = procurarCaminhosCSR(g, o, d, 0);
+            if (!fechada || !enumerados || !csr) {
+                confirmar("memória para os caminhos", mapa, 0);
+            } else {
+                cliqueUsada = cliqueUsada && fechada->metodo == CONTAGEM_CLIQUE;
+                contagemIgual = contagemIgual && fechada->total == enumerados->total &&
+                                enumerados->total == (unsigned long long)enumerados->numCaminhos;
+                csrIgual = csrIgual && csr->numCaminhos == enumerados->numCaminhos;
+                for (int k = 0; csrIgual && k <= csr->numCaminhos; k++) {
+                    csrIgual = csr->inicio[k] == enumerados->inicio[k];
+                }
+                for (int k = 0; csrIgual && k < csr->inicio[csr->numCaminhos]; k++) {
+                    csrIgual = g->vertices[csr->vertices[k]] == enumerados->vertices[k];
+                }
+                silenciarSaida();
+                int impressos = encontrarCaminhosIterativo(origem, destino);
+                reporSaida();
+                iterativoIgual = iterativoIgual && impressos == enumerados->numCaminhos;
+            }
+            libertarCaminhos(fechada);
+            libertarCaminhos(enumerados);
+            libertarCaminhosCSR(csr);
+        }
+    }
+    confirmar("contagem CONTAGEM_CLIQUE", mapa, cliqueUsada);
+    confirmar("fórmula fechada = enumeração", mapa, contagemIgual);
+    confirmar("procurarCaminhosCSR = procurarCaminhos", mapa, csrIgual);
+    confirmar("encontrarCaminhosIterativo = procurarCaminhos", mapa, iterativoIgual);
+}
+#pragma endregion
+#pragma region Ficheiros
+/**
+ * @brief Confirma que o diário "f x y" / "- x y" repetido por lerRegistos dá a lista em memória.
+ *
+ * Insere e remove antenas ao acaso num mapa 4 x 4 (várias antenas por posição) com
+ * InsereAntena e removeAntena, escrevendo cada alteração como no diário da 1.ª fase.
+ */
+static void verificarDiario(uint64_t* estado, int mapa) {
+    long operacoes = 400;
+    char* diario = (char*)malloc((size_t)operacoes * 32 + 1);
+    if (!diario) {
+        confirmar("memória para o diário", mapa, 0);
+        return;
+    }
+    size_t usado = 0;
+    Vertice* lista = NULL;
+    int res;
+    silenciarSaida();
+    for (long i = 0; i < operacoes; i++) {
+        int x = 1 + (int)(aleatorio(estado) % 4);
+        int y = 1 + (int)(aleatorio(estado) % 4);
+        if (aleatorio(estado) % 3 != 0) {
+            char frequencia = (char)('A' + aleatorio(estado) % 3);
+            lista = InsereAntena(criarAntena(frequencia, x, y), lista, &res);
+            if (res) usado += (size_t)sprintf(diario + usado, "%c %d %d\n", frequencia, x, y);
+            continue;
+        }
+        Vertice* v = lista;
+        while (v && (v->x != x || v->y != y)) v = v->prox;
+        if (!v) continue;
+        lista = removeAntena(lista, x, y);
+        usado += (size_t)sprintf(diario + usado, "- %d %d\n", x, y);
+    }
+    reporSaida();
+    Vertice* repetida = lerRegistos(diario, usado, NULL);
+    confirmar("diário lido por lerRegistos", mapa, mesmasListas(lista, repetida, 0));
+    libertarMemoria(lista);
+    libertarMemoria(repetida);
+    free(diario);
+}
+
+/**
+ * @brief Guarda a lista em cada formato e confirma que a leitura devolve a mesma lista.
+ */
+static void verificarFicheiros(Vertice* lista, int mapa) {
+    int ok = guardarGrafoBinario(lista, SNAPSHOT_VERIFICAR) == 0;
+    Vertice* lida = ok ? carregarAntenasDeFicheiroBinario(SNAPSHOT_VERIFICAR, NULL) : NULL;
+    confirmar("snapshot binário", mapa, ok && mesmasListas(lista, lida, 1));
+    libertarMemoria(lida);
+    ArenaGrafo* arena = criarArena();
+    lida = ok && arena ? carregarAntenasDeFicheiroBinario(SNAPSHOT_VERIFICAR, arena) : NULL;
+    confirmar("snapshot binário (arena)", mapa, ok && mesmasListas(lista, lida, 1));
+    libertarArena(arena);
+
+    ok = guardarAntenasRLE(lista, RLE_VERIFICAR) == 0;
+    lida = ok ? carregarAntenasAuto(RLE_VERIFICAR, NULL) : NULL;
+    confirmar("formato RLE", mapa, ok && mesmasListas(lista, lida, 0));
+    libertarMemoria(lida);
+
+    FILE* registos = fopen(REGISTOS_VERIFICAR, "w");
+    ok = registos != NULL;
+    for (Vertice* v = lista; ok && v; v = v->prox) fprintf(registos, "%c %d %d\n", v->frequencia, v->x, v->y);
+    if (registos) fclose(registos);
+    lida = ok ? carregarAntenasAuto(REGISTOS_VERIFICAR, NULL) : NULL;
+    confirmar("formato de registos", mapa, ok && mesmasListas(lista, lida, 0));
+    libertarMemoria(lida);
+
+    ok = guardarGrafoMapeado(lista, MAPEADO_VERIFICAR) == 0;
+    GrafoMapeado* g = ok ? abrirGrafoMapeado(MAPEADO_VERIFICAR, 1) : NULL;
+    ok = g != NULL;
+    int i = 0;
+    for (Vertice* v = lista; ok && v; v = v->prox, i++) {
+        ok = i < g->numVertices && g->x[i] == v->x && g->y[i] == v->y && g->frequencia[i] == v->frequencia &&
+             procurarVerticeMapeado(g, v->x, v->y) >= 0;
+        const uint32_t* vizinhos;
+        int grau = ok ? vizinhosMapeado(g, i, &vizinhos) : 0;
+        AdjD* adj = v->adjacencias;
+        for (int k = 0; ok && k < grau; k++, adj = adj->next) {
+            ok = adj && g->x[vizinhos[k]] == adj->destino->x && g->y[vizinhos[k]] == adj->destino->y;
+        }
+        ok = ok && !adj;
+    }
+    ok = ok && i == g->numVertices;
+    ConjuntoEfeitos* referencia = calcularEfeitos(lista, EFEITO_DISTANCIA_2);
+    ok = ok && referencia && referencia->total == g->numEfeitos;
+    for (int k = 0; ok && k < referencia->total; k++) {
+        ok = efeitoMapeado(g, referencia->celulas[k].x, referencia->celulas[k].y) == referencia->direcao[k];
+    }
+    confirmar("grafo mapeado", mapa, ok);
+    libertarConjuntoEfeitos(referencia);
+    fecharGrafoMapeado(g);
+}
+#pragma endregion
+#pragma region Main
+int main(int argc, char* argv[]) {
+    int mapas = argc > 1 ? atoi(argv[1]) : 40;
+    uint64_t semente = argc > 2 ? (uint64_t)strtoull(argv[2], NULL, 10) : 12345;
+    if (mapas <= 0) {
+        printf("Utilização: %s [mapas] [semente]\n", argv[0]);
+        return 1;
+    }
+    uint64_t estado = semente ? semente : 1;
+    for (int mapa = 0; mapa < mapas; mapa++) {
+        if (gerarMapa(MAPA_VERIFICAR, &estado) != 0) return 1;
+        Vertice* lista = carregarAntenasMapeado(MAPA_VERIFICAR);
+        if (!lista) continue;
+        verificarEfeitos(lista, mapa);
+        silenciarSaida();
+        CriarGrafo(lista);
+        reporSaida();
+        GrafoCSR* g = construirCSR(lista);
+        if (confirmar("construirCSR", mapa, g != NULL)) {
+            verificarPesquisas(lista, g, mapa);
+            verificarCaminhos(lista, g, mapa);
+            libertarCSR(g);
+        }
+        verificarFicheiros(lista, mapa);
+        verificarDiario(&estado, mapa);
+        libertarMemoria(lista);
+    }
+    remove(MAPA_VERIFICAR);
+    remove(SNAPSHOT_VERIFICAR);
+    remove(MAPEADO_VERIFICAR);
+    remove(RLE_VERIFICAR);
+    remove(REGISTOS_VERIFICAR);
+    if (falhas) {
+        printf("%d verificações falharam em %d mapas\n", falhas, mapas);
+        return 1;
+    }
+    printf("Todas as verificações passaram (%d mapas)\n", mapas);
+    return 0;
+}
+#pragma endregion
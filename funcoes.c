@@ -13,15 +13,169 @@
  #include <stdbool.h>
  #include <stdio.h>
  #include <stdlib.h>
+ #include <string.h>
  
 
+ #define DIARIO_FICHEIRO "antenas2.txt"
+ #define DIARIO_TEMPORARIO "antenas2.txt.tmp"   // Ficheiro escrito por compactarDiario antes de substituir o diário
+ #define DIARIO_CAPACIDADE (64 * 1024)   // Bytes guardados em memória antes de escrever no ficheiro
+ #define DIARIO_REGISTO_MAXIMO 64         // Espaço máximo ocupado por um registo
+
+ static char diario[DIARIO_CAPACIDADE];   // Alterações ainda não escritas no ficheiro
+ static size_t diarioUsado = 0;
+ static bool diarioRegistado = false;      // Se a escrita no fim do programa já foi registada com atexit
+
+
+ /**
+  * @brief Escreve no fim do programa as alterações que ainda estão no diário.
+  */
+ static void escreverDiarioNoFim(void) {
+     escreverDiario();
+ }
+
+
+ /**
+  * @brief Acrescenta um registo ao diário de alterações.
+  * 
+  * O registo só é escrito no ficheiro quando o diário enche, quando é chamado
+  * escreverDiario ou no fim do programa.
+  * 
+  * @param registo Texto do registo (terminado em '\n').
+  * @param tamanho Número de caracteres do registo.
+  */
+ static void registarDiario(const char *registo, int tamanho) {
+     if (tamanho <= 0) {
+         return;
+     }
+     if (!diarioRegistado) {
+         atexit(escreverDiarioNoFim);
+         diarioRegistado = true;
+     }
+     if (diarioUsado + (size_t)tamanho > DIARIO_CAPACIDADE && escreverDiario() != 0) {
+         printf("Diário cheio, a alteração não foi guardada em antenas2.txt!\n");
+         return;
+     }
+     memcpy(diario + diarioUsado, registo, (size_t)tamanho);
+     diarioUsado += (size_t)tamanho;
+ }
+
+
+ /**
+  * @brief Regista no diário a inserção de uma antena ("f x y").
+  */
+ static void registarInsercao(char frequencia, int x, int y) {
+     char registo[DIARIO_REGISTO_MAXIMO];
+     registarDiario(registo, snprintf(registo, sizeof(registo), "%c %d %d\n", frequencia, x, y));
+ }
+
+
+ /**
+  * @brief Regista no diário a remoção de uma antena com uma marca "- x y".
+  */
+ static void registarRemocao(int x, int y) {
+     char registo[DIARIO_REGISTO_MAXIMO];
+     registarDiario(registo, snprintf(registo, sizeof(registo), "- %d %d\n", x, y));
+ }
+
+
+ /**
+  * @brief Escreve no ficheiro "antenas2.txt" as alterações guardadas no diário.
+  * 
+  * As inserções e remoções são acrescentadas ao ficheiro de uma só vez (um fopen e um fwrite
+  * para muitas alterações). As remoções ficam como marcas "- x y", que retiram a antena inserida
+  * mais recentemente nessa posição (a mesma que removerAntena retira da lista); compactarDiario
+  * reescreve o ficheiro só com as antenas existentes. Se o ficheiro não puder ser escrito, as
+  * alterações que ficaram por escrever continuam no diário para a próxima tentativa (as que já
+  * foram escritas saem do diário, para não ficarem repetidas no ficheiro).
+  * 
+  * @return int 0 em caso de sucesso, -1 se não foi possível escrever no ficheiro.
+  */
+ int escreverDiario(void) {
+     if (diarioUsado == 0) {
+         return 0;
+     }
+     FILE *file = fopen(DIARIO_FICHEIRO, "a");
+     if (!file) {
+         printf("Erro ao abrir o ficheiro para guardar antenas!\n");
+         return -1;
+     }
+     size_t escritos = fwrite(diario, 1, diarioUsado, file);
+     int fechou = fclose(file) == 0;
+     if (escritos != diarioUsado || !fechou) {
+         printf("Erro ao guardar as antenas no ficheiro!\n");
+         if (escritos != diarioUsado) {
+             // Mantém só o que ficou por escrever
+             memmove(diario, diario + escritos, diarioUsado - escritos);
+             diarioUsado -= escritos;
+         }
+         return -1;
+     }
+     diarioUsado = 0;
+     return 0;
+ }
+
+
+ /**
+  * @brief Reescreve o ficheiro "antenas2.txt" apenas com as antenas da lista.
+  * 
+  * O ficheiro novo é escrito em "antenas2.txt.tmp" e só substitui "antenas2.txt" depois de
+  * todas as escritas terem corrido bem; até lá o ficheiro antigo e o diário ficam intactos.
+  * As alterações pendentes no diário só são descartadas depois da substituição, porque a
+  * lista já as contém. O ficheiro fica sem marcas de remoção.
+  * 
+  * @param lista Ponteiro para a lista de antenas.
+  * @return int 0 em caso de sucesso, -1 se não foi possível escrever no ficheiro.
+  */
+ int compactarDiario(Antena *lista) {
+     char *bloco = (char *)malloc(DIARIO_CAPACIDADE);
+     if (!bloco) {
+         printf("Erro ao alocar memória para guardar antenas!\n");
+         return -1;
+     }
+     FILE *file = fopen(DIARIO_TEMPORARIO, "w");
+     if (!file) {
+         printf("Erro ao abrir o ficheiro para guardar antenas!\n");
+         free(bloco);
+         return -1;
+     }
+     size_t usado = 0;
+     int erro = 0;
+     for (Antena *aux = lista; aux && !erro; aux = aux->prox) {
+         if (usado + DIARIO_REGISTO_MAXIMO > DIARIO_CAPACIDADE) {
+             erro = fwrite(bloco, 1, usado, file) != usado;
+             usado = 0;
+         }
+         usado += (size_t)snprintf(bloco + usado, DIARIO_REGISTO_MAXIMO, "%c %d %d\n",
+                                   aux->frequencia, aux->x, aux->y);
+     }
+     if (!erro) {
+         erro = fwrite(bloco, 1, usado, file) != usado;
+     }
+     erro = fclose(file) != 0 || erro;
+     free(bloco);
+     if (erro) {
+         printf("Erro ao guardar as antenas no ficheiro!\n");
+         remove(DIARIO_TEMPORARIO);
+         return -1;
+     }
+     if (rename(DIARIO_TEMPORARIO, DIARIO_FICHEIRO) != 0 &&
+         // Em Windows rename não substitui um ficheiro que já existe
+         (remove(DIARIO_FICHEIRO) != 0 || rename(DIARIO_TEMPORARIO, DIARIO_FICHEIRO) != 0)) {
+         // O ficheiro temporário fica, com as antenas todas
+         printf("Erro ao substituir %s por %s!\n", DIARIO_FICHEIRO, DIARIO_TEMPORARIO);
+         return -1;
+     }
+     diarioUsado = 0;
+     return 0;
+ }
+
  /**
   * @brief Insere uma nova antena na lista ligada de forma ordenada e não admite repetições das coordenadas.
   * 
   * Cria uma nova antena e insere-a na lista de forma ordenada, garantindo que não existam 
   * repetições de antenas com a mesma frequência e coordenadas.
   * A inserção ocorre de forma crescente priorizando a coordenada x (as linhas) e em caso de igualdade, a coordenada y (colunas).
-  * A função guarda as antenas no arquivo "antenas2.txt".
+  * A função regista as antenas no diário, que é escrito no arquivo "antenas2.txt" em blocos.
   * 
   * @param lista Ponteiro para a lista de antenas.
   * @param frequencia Caracter que representa a frequência da antena.
@@ -41,17 +195,12 @@
      nova->x = x;
      nova->y = y;
      nova->prox = NULL;
+     nova->ant = NULL;
  
      // Se a lista estiver vazia a nova antena torna-se o primeiro nó
      if (lista == NULL) {
-         // Abre o arquivo para guardar a antena
-         FILE *file = fopen("antenas2.txt", "a");
-         if (!file) {
-             printf("Erro ao abrir o ficheiro para guardar antenas!\n");
-         } else {
-             fprintf(file, "%c %d %d\n", frequencia, x, y);  // Guarda no arquivo
-             fclose(file);
-         }
+         // Regista a antena no diário (escrito em "antenas2.txt" mais tarde)
+         registarInsercao(frequencia, x, y);
          return nova;
      }
  
@@ -68,16 +217,11 @@
  
  
      // Inserção ordenada (primeiro por x, depois por y em caso de igualdade)
-     if (lista->x > nova->x || (lista->x == nova->x && lista->y > nova->y)) {  //   || (or/ou)
+     if (lista->x > nova->x || (lista->x == nova->x && lista->y >= nova->y)) {  //   || (or/ou)
          nova->prox = lista;
-         // Guardar a antena no arquivo
-         FILE *file = fopen("antenas2.txt", "a");
-         if (!file) {
-             printf("Erro ao abrir o ficheiro para guardar antenas!\n");
-         } else {
-             fprintf(file, "%c %d %d\n", frequencia, x, y);  // Guarda no arquivo
-             fclose(file);
-         }
+         lista->ant = nova;
+         // Regista a antena no diário (escrito em "antenas2.txt" mais tarde)
+         registarInsercao(frequencia, x, y);
          return nova;
      }
  
@@ -93,17 +237,15 @@
      if (anterior != NULL) {
          anterior->prox = nova;
      }
+     nova->ant = anterior;
      nova->prox = aux;
- 
-     // Guardar a antena no arquivo
-     FILE *file = fopen("antenas2.txt", "a");
-     if (!file) {
-         printf("Erro ao abrir o ficheiro para guardar antenas!\n");
-     } else {
-         fprintf(file, "%c %d %d\n", frequencia, x, y);  // Guarda no arquivo
-         fclose(file);
+     if (aux != NULL) {
+         aux->ant = nova;
      }
  
+     // Regista a antena no diário (escrito em "antenas2.txt" mais tarde)
+     registarInsercao(frequencia, x, y);
+ 
      return lista;
  }
 
@@ -165,25 +307,16 @@ Antena* removerAntena(Antena *lista, int x, int y) {
             } else {
                 anterior->prox = atual->prox;
             }
+            if (atual->prox) {
+                atual->prox->ant = anterior;
+            }
 
             // Liberta a memória da antena removida
             free(atual);
             printf("Antena removida com sucesso!\n");
 
-            // Atualiza ficheiro sem a removida
-            FILE *file = fopen("antenas2.txt", "w");
-            if (!file) {
-                printf("Erro ao abrir o ficheiro para guardar antenas!\n");
-                return lista;
-            }
-
-            // Percorre a lista e grava os dados atualizados no ficheiro
-            Antena *aux = lista;
-            while (aux) {
-                fprintf(file, "%c %d %d\n", aux->frequencia, aux->x, aux->y);
-                aux = aux->prox;
-            }
-            fclose(file);
+            // Regista a remoção no diário em vez de reescrever o ficheiro
+            registarRemocao(x, y);
             printf("Antena removida no ficheiro!\n");
             return lista;
         }
@@ -249,11 +382,287 @@ Antena* removerAntena(Antena *lista, int x, int y) {
  
 
  
+ /**
+  * @brief Cria um índice de posições vazio.
+  * 
+  * O índice usa a tabela de posições partilhada com a 2.ª fase (posicoes.h). Cada posição
+  * (x, y) aponta para a primeira antena da lista com essas coordenadas; as restantes antenas
+  * da mesma posição estão logo a seguir na lista, porque esta está ordenada por (x, y).
+  * Cada linha x aponta para a última antena da lista nessa linha.
+  * 
+  * @param capacidade Número de posições previsto (0 para o valor por omissão).
+  * @return IndiceAntenas* Ponteiro para o índice, ou NULL em caso de erro.
+  */
+ IndiceAntenas* criarIndice(int capacidade) {
+     IndiceAntenas *indice = (IndiceAntenas *)malloc(sizeof(IndiceAntenas));
+     if (!indice) {
+         printf("Erro ao criar memória!\n");
+         return NULL;
+     }
+     int posicoes = iniciarTabelaPosicoes(&indice->posicoes, capacidade);
+     int linhas = iniciarTabelaPosicoes(&indice->linhas, 0);
+     if (!posicoes || !linhas) {
+         printf("Erro ao criar memória!\n");
+         libertarTabelaPosicoes(&indice->posicoes);
+         libertarTabelaPosicoes(&indice->linhas);
+         free(indice);
+         return NULL;
+     }
+     indice->cauda = NULL;
+     return indice;
+ }
+
+
+
+ /**
+  * @brief Procura a primeira antena da lista na posição (x, y).
+  * 
+  * @param indice Índice de posições.
+  * @param x Coordenada X.
+  * @param y Coordenada Y.
+  * @return Antena* Ponteiro para a antena, ou NULL se não existir.
+  */
+ Antena* procurarIndice(IndiceAntenas *indice, int x, int y) {
+     if (!indice) return NULL;
+     return (Antena *)procurarPosicao(&indice->posicoes, x, y);
+ }
+
+
+
+ /**
+  * @brief Procura a antena depois da qual fica uma nova antena na posição (x, y).
+  * 
+  * Parte da última antena da linha x (ou da linha anterior mais próxima com antenas)
+  * e só recua dentro da linha, por isso não percorre a lista desde o início.
+  * 
+  * @param indice Índice de posições.
+  * @param lista Ponteiro para a lista de antenas.
+  * @param x Coordenada X.
+  * @param y Coordenada Y.
+  * @return Antena* Antena anterior, ou NULL se a nova antena ficar no início da lista.
+  */
+ static Antena* antecessorIndice(IndiceAntenas *indice, Antena *lista, int x, int y) {
+     Antena *posicao = procurarIndice(indice, x, y);
+     if (posicao != NULL) {
+         return posicao->ant;
+     }
+     if (lista == NULL || lista->x > x || (lista->x == x && lista->y > y)) {
+         return NULL;
+     }
+     if ((long long)x - lista->x > indice->posicoes.ocupadas) {
+         // Linhas muito dispersas: recua a partir da última antena
+         Antena *aux = indice->cauda;
+         while (aux != NULL && (aux->x > x || (aux->x == x && aux->y > y))) {
+             aux = aux->ant;
+         }
+         return aux;
+     }
+     for (int linha = x; linha >= lista->x; linha--) {
+         Antena *ultima = (Antena *)procurarPosicao(&indice->linhas, linha, 0);
+         if (ultima == NULL) continue;
+         while (ultima != NULL && ultima->x == x && ultima->y > y) {
+             ultima = ultima->ant;
+         }
+         return ultima;
+     }
+     return NULL;
+ }
+
+
+
+ /**
+  * @brief Regista no índice uma antena que acabou de ser ligada à lista.
+  * 
+  * @param indice Índice de posições.
+  * @param antena Antena já ligada (ant e prox definidos).
+  * @return true em caso de sucesso, false se faltar memória (o índice fica como estava).
+  */
+ static bool registarAntenaIndice(IndiceAntenas *indice, Antena *antena) {
+     bool primeiraPosicao = antena->ant == NULL || antena->ant->x != antena->x || antena->ant->y != antena->y;
+     bool ultimaLinha = antena->prox == NULL || antena->prox->x != antena->x;
+     Antena *linhaAnterior = (Antena *)procurarPosicao(&indice->linhas, antena->x, 0);
+     if (ultimaLinha && !definirPosicao(&indice->linhas, antena->x, 0, antena)) {
+         return false;
+     }
+     if (primeiraPosicao && !definirPosicao(&indice->posicoes, antena->x, antena->y, antena)) {
+         if (ultimaLinha && linhaAnterior != NULL) {
+             definirPosicao(&indice->linhas, antena->x, 0, linhaAnterior);
+         } else if (ultimaLinha) {
+             retirarPosicao(&indice->linhas, antena->x, 0);
+         }
+         return false;
+     }
+     if (antena->prox == NULL) {
+         indice->cauda = antena;
+     }
+     return true;
+ }
+
+
+
+ /**
+  * @brief Retira do índice uma antena que vai sair da lista.
+  * 
+  * @param indice Índice de posições.
+  * @param antena Antena ainda ligada à lista.
+  */
+ static void retirarAntenaIndice(IndiceAntenas *indice, Antena *antena) {
+     int x = antena->x, y = antena->y;
+     // A posição passa para a antena seguinte ou deixa de existir
+     if (procurarIndice(indice, x, y) == antena) {
+         if (antena->prox != NULL && antena->prox->x == x && antena->prox->y == y) {
+             definirPosicao(&indice->posicoes, x, y, antena->prox);
+         } else {
+             retirarPosicao(&indice->posicoes, x, y);
+         }
+     }
+     // A linha passa para a antena anterior ou deixa de existir
+     if (procurarPosicao(&indice->linhas, x, 0) == antena) {
+         if (antena->ant != NULL && antena->ant->x == x) {
+             definirPosicao(&indice->linhas, x, 0, antena->ant);
+         } else {
+             retirarPosicao(&indice->linhas, x, 0);
+         }
+     }
+     if (indice->cauda == antena) {
+         indice->cauda = antena->ant;
+     }
+ }
+
+
+
+ /**
+  * @brief Liberta a memória do índice (as antenas continuam na lista).
+  * 
+  * @param indice Índice de posições.
+  */
+ void libertarIndice(IndiceAntenas *indice) {
+     if (!indice) return;
+     libertarTabelaPosicoes(&indice->posicoes);
+     libertarTabelaPosicoes(&indice->linhas);
+     free(indice);
+ }
+
+
+
+ /**
+  * @brief Insere uma nova antena na lista ordenada usando o índice de posições.
+  * 
+  * Faz o mesmo que inserirAntena (incluindo guardar no ficheiro "antenas2.txt"), mas a
+  * verificação de repetição só consulta as antenas da posição (x, y) e o lugar na lista
+  * é encontrado a partir da última antena da linha, sem percorrer a lista.
+  * A lista só deve ser alterada pelas funções indexadas enquanto o índice estiver em uso.
+  * 
+  * @param lista Ponteiro para a lista de antenas.
+  * @param indice Índice de posições da lista.
+  * @param frequencia Caracter que representa a frequência da antena.
+  * @param x Coordenada X da antena.
+  * @param y Coordenada Y da antena.
+  * @return Antena* Retorna a lista atualizada com a nova antena, se for inserida.
+  */
+ Antena* inserirAntenaIndexada(Antena *lista, IndiceAntenas *indice, char frequencia, int x, int y) {
+     if (!indice) {
+         return inserirAntena(lista, frequencia, x, y);
+     }
+     // Verifica apenas as antenas que estão na mesma posição
+     Antena *aux = procurarIndice(indice, x, y);
+     while (aux != NULL && aux->x == x && aux->y == y) {
+         if (aux->frequencia == frequencia) {
+             printf("Antena já existe!\n");
+             return lista;
+         }
+         aux = aux->prox;
+     }
+
+     Antena *nova = (Antena *)malloc(sizeof(Antena));
+     if (!nova) {
+         printf("Erro ao criar memória!\n");
+         return lista;
+     }
+     nova->frequencia = frequencia;
+     nova->x = x;
+     nova->y = y;
+     // Fica antes das antenas da mesma posição, tal como em inserirAntena
+     Antena *anterior = antecessorIndice(indice, lista, x, y);
+     nova->ant = anterior;
+     nova->prox = anterior != NULL ? anterior->prox : lista;
+     if (nova->prox != NULL) {
+         nova->prox->ant = nova;
+     }
+     if (anterior != NULL) {
+         anterior->prox = nova;
+     } else {
+         lista = nova;
+     }
+     if (!registarAntenaIndice(indice, nova)) {
+         // Sem memória para o índice: a antena sai outra vez da lista
+         printf("Erro ao criar memória!\n");
+         if (nova->ant != NULL) {
+             nova->ant->prox = nova->prox;
+         } else {
+             lista = nova->prox;
+         }
+         if (nova->prox != NULL) {
+             nova->prox->ant = nova->ant;
+         }
+         free(nova);
+         return lista;
+     }
+
+     // Regista a antena no diário (escrito em "antenas2.txt" mais tarde)
+     registarInsercao(frequencia, x, y);
+     return lista;
+ }
+
+
+
+ /**
+  * @brief Remove uma antena da lista com base nas coordenadas (x, y) usando o índice de posições.
+  * 
+  * Remove a mesma antena que removerAntena (a primeira da lista nessa posição), mas encontra-a
+  * pelo índice e desliga-a pelo ponteiro para a antena anterior, sem percorrer a lista.
+  * A remoção é registada no diário da mesma forma.
+  * 
+  * @param lista Ponteiro para a lista de antenas.
+  * @param indice Índice de posições da lista.
+  * @param x Coordenada X da antena a ser removida.
+  * @param y Coordenada Y da antena a ser removida.
+  * @return Antena* Retorna a lista atualizada após a remoção da antena.
+  */
+ Antena* removerAntenaIndexada(Antena *lista, IndiceAntenas *indice, int x, int y) {
+     if (!indice) {
+         return removerAntena(lista, x, y);
+     }
+     Antena *atual = procurarIndice(indice, x, y);
+     if (atual == NULL) {
+         printf("Antena não encontrada!\n");
+         return lista;
+     }
+     retirarAntenaIndice(indice, atual);
+     if (atual->ant != NULL) {
+         atual->ant->prox = atual->prox;
+     } else {
+         lista = atual->prox;
+     }
+     if (atual->prox != NULL) {
+         atual->prox->ant = atual->ant;
+     }
+     free(atual);
+     printf("Antena removida com sucesso!\n");
+
+     // Regista a remoção no diário em vez de reescrever o ficheiro
+     registarRemocao(x, y);
+     printf("Antena removida no ficheiro!\n");
+     return lista;
+ }
+
+ 
  /**
   * @brief Carrega antenas a partir de um ficheiro e as insere na lista ligada.
   * 
   * A função lê um ficheiro linha por linha, considerando cada caractere (exceto '.' e '\n')
   * como uma antena, e insere-a na lista ligada com suas respectivas coordenadas.
+  * Usa um índice de posições temporário para não percorrer a lista em cada inserção.
   * 
   * @param nomeFicheiro Nome do ficheiro contendo a matriz de antenas.
   * @return Antena* Retorna um ponteiro para a lista ligada contendo as antenas carregadas.
@@ -269,17 +678,19 @@ Antena* removerAntena(Antena *lista, int x, int y) {
      Antena *lista = NULL;
      int linha = 0;
      char linhaFicheiro[256];
+     IndiceAntenas *indice = criarIndice(0); // Evita percorrer a lista em cada inserção
  
      // Lê cada linha do ficheiro e adiciona as antenas na lista
      while (fgets(linhaFicheiro, sizeof(linhaFicheiro), file)) {
          for (int coluna = 0; linhaFicheiro[coluna] != '\n' && linhaFicheiro[coluna] != '\0'; coluna++) { //  \n indica fim de linha
              if (linhaFicheiro[coluna] != '.' && linhaFicheiro[coluna] != '\n') {
-                 lista = inserirAntena(lista, linhaFicheiro[coluna], linha + 1, coluna + 1); //inseri +1 pra não começar no 0 as coordenadas
+                 lista = inserirAntenaIndexada(lista, indice, linhaFicheiro[coluna], linha + 1, coluna + 1); //inseri +1 pra não começar no 0 as coordenadas
              }
          }
          linha++;
      }
  
+     libertarIndice(indice);
      fclose(file);
      return lista;
  }
@@ -334,11 +745,90 @@ Antena* removerAntena(Antena *lista, int x, int y) {
 
 
 
+ /**
+  * @brief Cópia de uma antena usada para a agrupar por frequência e linha/coluna.
+  */
+ typedef struct AntenaOrdenada {
+     char frequencia;
+     int x, y;
+     int ordem; // Posição da antena na lista
+ } AntenaOrdenada;
+
+
+
+ /**
+  * @brief Compara antenas por frequência, x, y e posição na lista.
+  */
+ static int compararPorX(const void *a, const void *b) {
+     const AntenaOrdenada *p = a, *q = b;
+     if (p->frequencia != q->frequencia) return (unsigned char)p->frequencia < (unsigned char)q->frequencia ? -1 : 1;
+     if (p->x != q->x) return p->x < q->x ? -1 : 1;
+     if (p->y != q->y) return p->y < q->y ? -1 : 1;
+     return (p->ordem > q->ordem) - (p->ordem < q->ordem);
+ }
+
+
+
+ /**
+  * @brief Compara antenas por frequência, y, x e posição na lista.
+  */
+ static int compararPorY(const void *a, const void *b) {
+     const AntenaOrdenada *p = a, *q = b;
+     if (p->frequencia != q->frequencia) return (unsigned char)p->frequencia < (unsigned char)q->frequencia ? -1 : 1;
+     if (p->y != q->y) return p->y < q->y ? -1 : 1;
+     if (p->x != q->x) return p->x < q->x ? -1 : 1;
+     return (p->ordem > q->ordem) - (p->ordem < q->ordem);
+ }
+
+
+
+ /**
+  * @brief Acrescenta um efeito ao conjunto (tabela de posições sem limite de tamanho) se ainda não existir.
+  * 
+  * @param c Conjunto de efeitos.
+  * @param x Coordenada X do efeito.
+  * @param y Coordenada Y do efeito.
+  * @return int 1 se o efeito é novo, 0 se já existia, -1 em caso de erro de memória.
+  */
+ static int adicionarEfeito(TabelaPosicoes *c, int x, int y) {
+     if (procurarPosicao(c, x, y) != NULL) {
+         return 0; // O efeito já existe
+     }
+     // Só interessa a posição: a própria tabela serve de valor não nulo
+     return definirPosicao(c, x, y, c) ? 1 : -1;
+ }
+
+
+
+ /**
+  * @brief Regista um efeito e imprime-o se ainda não tinha sido encontrado.
+  * 
+  * @param c Conjunto de efeitos.
+  * @param x Coordenada X do efeito.
+  * @param y Coordenada Y do efeito.
+  * @return true Em caso de sucesso.
+  * @return false Em caso de erro de memória.
+  */
+ static bool registarEfeito(TabelaPosicoes *c, int x, int y) {
+     int novo = adicionarEfeito(c, x, y);
+     if (novo == 1) {
+         printf("     (%d, %d)\n", x, y);
+     }
+     return novo >= 0;
+ }
+
+
+
  /**
   * @brief Deduz e imprime as localizações onde existe efeitos nefastos causados por antenas da mesma frequência.
   * 
   * A função verifica todas as antenas da lista e identifica pares alinhados (horizontalmente ou verticalmente)
   * que a distância tem de ser múltiplo de 2. O ponto médio entre essas antenas é considerado um ponto de efeito nefasto.
+  * 
+  * Em vez de comparar cada antena com todas as outras, as antenas são ordenadas por (frequência, x, y) e por
+  * (frequência, y, x), e cada uma só é comparada com as do seu grupo (mesma frequência e mesma linha ou coluna),
+  * pela ordem da lista. Os efeitos já encontrados ficam numa tabela de dispersão sem limite de tamanho,
+  * por isso os resultados são impressos pela mesma ordem que antes e sem repetições.
   * @param lista Ponteiro para a lista de antenas.
   */
  void deduzirEfeitosNefastos(Antena *lista) {
@@ -346,36 +836,69 @@ Antena* removerAntena(Antena *lista, int x, int y) {
      printf("Coordenadas (x, y)\n");
      printf("-------------------\n");
  
-     int efeitos[100][2]; //  Guarda efeitos encontrados
-     int totalEfeitos = 0;
- 
-     // Percorre todas as antenas para identificar efeitos nefastos
-     for (Antena *a1 = lista; a1 != NULL; a1 = a1->prox) {
-         for (Antena *a2 = lista; a2 != NULL; a2 = a2->prox) {
-             if (a1 != a2 && a1->frequencia == a2->frequencia) {
-                 int dx = a2->x - a1->x;
-                 int dy = a2->y - a1->y;
- 
-                 // Verifica se a distância é múltipla de 2
-                 if ((dx == 0 && abs(dy) % 2 == 0) || (dy == 0 && abs(dx) % 2 == 0)) {
-                     int meioX = a1->x + dx / 2;
-                     int meioY = a1->y + dy / 2;
- 
-                     // Só imprime se o efeito ainda não está na lista dos efeitos nesfatos
-                     if (!efeitoExiste(efeitos, totalEfeitos, meioX, meioY)) {
-                         printf("     (%d, %d)\n", meioX , meioY);
-                         efeitos[totalEfeitos][0] = meioX;
-                         efeitos[totalEfeitos][1] = meioY;
-                         totalEfeitos++;
-                     }
-                 }
-             }
+     int n = 0;
+     for (Antena *a = lista; a != NULL; a = a->prox) {
+         n++;
+     }
+     TabelaPosicoes efeitos; //  Guarda efeitos encontrados
+     bool tabela = iniciarTabelaPosicoes(&efeitos, 0);
+     AntenaOrdenada *porX = (AntenaOrdenada *)malloc((n + 1) * sizeof(AntenaOrdenada));
+     AntenaOrdenada *porY = (AntenaOrdenada *)malloc((n + 1) * sizeof(AntenaOrdenada));
+     int *posX = (int *)malloc((n + 1) * sizeof(int));
+     int *posY = (int *)malloc((n + 1) * sizeof(int));
+     bool ok = tabela && porX && porY && posX && posY;
+     if (ok) {
+         int i = 0;
+         for (Antena *a = lista; a != NULL; a = a->prox, i++) {
+             porX[i].frequencia = a->frequencia;
+             porX[i].x = a->x;
+             porX[i].y = a->y;
+             porX[i].ordem = i;
+             porY[i] = porX[i];
+         }
+         qsort(porX, n, sizeof(AntenaOrdenada), compararPorX);
+         qsort(porY, n, sizeof(AntenaOrdenada), compararPorY);
+         for (i = 0; i < n; i++) {
+             posX[porX[i].ordem] = i;
+             posY[porY[i].ordem] = i;
          }
      }
  
-     if (totalEfeitos == 0) {
+     // Percorre as antenas pela ordem da lista e compara-as só com o seu grupo
+     for (int i = 0; ok && i < n; i++) {
+         AntenaOrdenada *a1 = &porX[posX[i]];
+         int iniX = posX[i], fimX = posX[i], iniY = posY[i], fimY = posY[i];
+         while (iniX > 0 && porX[iniX - 1].frequencia == a1->frequencia && porX[iniX - 1].x == a1->x) iniX--;
+         while (fimX + 1 < n && porX[fimX + 1].frequencia == a1->frequencia && porX[fimX + 1].x == a1->x) fimX++;
+         while (iniY > 0 && porY[iniY - 1].frequencia == a1->frequencia && porY[iniY - 1].y == a1->y) iniY--;
+         while (fimY + 1 < n && porY[fimY + 1].frequencia == a1->frequencia && porY[fimY + 1].y == a1->y) fimY++;
+ 
+         // Mesma coluna antes, mesma linha, mesma coluna depois (ordem da lista)
+         for (int k = iniY; ok && k <= fimY && porY[k].x < a1->x; k++) {
+             int dx = porY[k].x - a1->x;
+             if (abs(dx) % 2 == 0) ok = registarEfeito(&efeitos, a1->x + dx / 2, a1->y);
+         }
+         for (int k = iniX; ok && k <= fimX; k++) {
+             int dy = porX[k].y - a1->y;
+             if (porX[k].ordem != i && abs(dy) % 2 == 0) ok = registarEfeito(&efeitos, a1->x, a1->y + dy / 2);
+         }
+         for (int k = iniY; ok && k <= fimY; k++) {
+             int dx = porY[k].x - a1->x;
+             if (dx > 0 && dx % 2 == 0) ok = registarEfeito(&efeitos, a1->x + dx / 2, a1->y);
+         }
+     }
+     if (!ok) {
+         printf("Erro ao criar memória!\n");
+     }
+ 
+     if (efeitos.ocupadas == 0) {
          printf("Nenhum efeito nefasto encontrado.\n");
      }
+     free(porX);
+     free(porY);
+     free(posX);
+     free(posY);
+     libertarTabelaPosicoes(&efeitos);
  }
  
 
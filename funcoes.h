@@ -14,6 +14,7 @@
  
  #include <stdio.h>
  #include <stdlib.h>
+ #include "Trabalho Prático - 2º Fase EDA/biblioteca/posicoes.h"
  
  /**
   * @struct Antena
@@ -30,16 +31,42 @@
   * 
   * @var Antena::prox
   * Ponteiro para a próxima antena na lista ligada.
+  * 
+  * @var Antena::ant
+  * Ponteiro para a antena anterior na lista ligada.
   */
  typedef struct Antena {
      char frequencia; //Frequência da antena (exemplos utilizados:'0', 'A', 'B', 'C')
      int x,y;       // Coordenadas da antena no plano (x, y)
      struct Antena *prox; //Ponteiro para a próxima antena da lista
+     struct Antena *ant;  //Ponteiro para a antena anterior (remoção sem percorrer a lista)
  } Antena;
  
 
 
 
+ /**
+  * @struct IndiceAntenas
+  * @brief Índice de posições da lista, sobre a tabela de posições partilhada com a 2.ª fase.
+  * 
+  * @var IndiceAntenas::posicoes
+  * Associa cada posição (x, y) à primeira antena da lista nessa posição.
+  * 
+  * @var IndiceAntenas::linhas
+  * Associa cada linha (x, 0) à última antena da lista nessa linha.
+  * 
+  * @var IndiceAntenas::cauda
+  * Última antena da lista.
+  */
+ typedef struct IndiceAntenas {
+     TabelaPosicoes posicoes; // Primeira antena da lista em cada posição
+     TabelaPosicoes linhas;   // Última antena da lista em cada linha (lugar de uma nova antena)
+     Antena *cauda;           // Última antena da lista (inserção no fim sem percorrer)
+ } IndiceAntenas;
+ 
+
+
+
 
  /**
   * @brief Insere uma nova antena na lista.
@@ -57,6 +84,22 @@
 
 
 
+ /**
+  * @brief Insere uma nova antena na lista usando o índice de posições.
+  * 
+  * @param lista Ponteiro para a lista de antenas.
+  * @param indice Índice de posições da lista.
+  * @param frequencia Caracter que representa a frequência da antena.
+  * @param x Coordenada X da antena.
+  * @param y Coordenada Y da antena.
+  * @return Ponteiro atualizado para a lista de antenas.
+  */
+ Antena* inserirAntenaIndexada(Antena *lista, IndiceAntenas *indice, char frequencia, int x, int y);
+ 
+
+
+
+
  /**
   * @brief Remove uma antena com base nas coordenadas (x, y).
   * 
@@ -71,6 +114,81 @@
 
 
 
+ /**
+  * @brief Remove uma antena com base nas coordenadas (x, y) usando o índice de posições.
+  * 
+  * @param lista Ponteiro para a lista de antenas.
+  * @param indice Índice de posições da lista.
+  * @param x Coordenada X da antena a ser removida.
+  * @param y Coordenada Y da antena a ser removida.
+  * @return Ponteiro atualizado para a lista de antenas.
+  */
+ Antena* removerAntenaIndexada(Antena *lista, IndiceAntenas *indice, int x, int y);
+ 
+
+
+
+
+ /**
+  * @brief Escreve no ficheiro "antenas2.txt" as alterações pendentes no diário.
+  * 
+  * @return int 0 em caso de sucesso, -1 em caso de erro.
+  */
+ int escreverDiario(void);
+ 
+
+
+
+
+ /**
+  * @brief Reescreve o ficheiro "antenas2.txt" só com as antenas da lista (sem marcas de remoção).
+  * 
+  * @param lista Ponteiro para a lista de antenas.
+  * @return int 0 em caso de sucesso, -1 em caso de erro.
+  */
+ int compactarDiario(Antena *lista);
+ 
+
+
+
+
+ /**
+  * @brief Cria um índice de posições vazio.
+  * 
+  * @param capacidade Número de posições previsto (0 para o valor por omissão).
+  * @return Ponteiro para o índice, ou NULL em caso de erro.
+  */
+ IndiceAntenas* criarIndice(int capacidade);
+ 
+
+
+
+
+ /**
+  * @brief Procura a primeira antena da lista na posição (x, y).
+  * 
+  * @param indice Índice de posições.
+  * @param x Coordenada X.
+  * @param y Coordenada Y.
+  * @return Ponteiro para a antena, ou NULL se não existir.
+  */
+ Antena* procurarIndice(IndiceAntenas *indice, int x, int y);
+ 
+
+
+
+
+ /**
+  * @brief Liberta a memória do índice (as antenas continuam na lista).
+  * 
+  * @param indice Índice de posições.
+  */
+ void libertarIndice(IndiceAntenas *indice);
+ 
+
+
+
+
  /**
   * @brief Lista todas as antenas armazenadas na lista.
   * 
@@ -72,6 +72,14 @@
 
 
 
+     /**
+      * Reescreve "antenas2.txt" só com as antenas existentes (sem as marcas de remoção).
+      */
+     compactarDiario(listaAntenas);
+
+
+
+
      /**
       * Liberta memória para evitar desperdício da mesma.
       */